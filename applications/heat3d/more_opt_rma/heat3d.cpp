@@ -23,10 +23,12 @@
 
 #include <comm.hpp>
 
+using Kokkos::Experimental::RemoteSpaces::RemoteDualView;
+
 using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
 using LocalView_t   = Kokkos::View<double***>;
 using RemoteView_t  = Kokkos::View<double***, RemoteSpace_t>;
-using HostView_t    = typename RemoteView_t::HostMirror;
+using DualView_t    = RemoteDualView<RemoteView_t>;
 using Exec_t        = Kokkos::DefaultExecutionSpace;
 
 struct CommHelper {
@@ -87,8 +89,9 @@ struct System {
 
   // Temperature and delta Temperature
   RemoteView_t T;
-  LocalView_t dT, T_l;
-  HostView_t T_h;
+  DualView_t T_dv;
+  DualView_t::local_view_type T_l;
+  LocalView_t dT;
 
   Exec_t E_left, E_right, E_up, E_down, E_front, E_back, E_bulk;
 
@@ -154,13 +157,14 @@ struct System {
     printf("My Domain: %i (%i %i %i) (%i %i %i)\n", comm.me, my_lo_x, Y_lo,
            Z_lo, my_hi_x, Y_hi, Z_hi);
 #endif
-    T   = RemoteView_t("System::T", X, Y, Z);
-    T_l = LocalView_t(T.data(), T.extent(0), Y, Z);
-    T_h = HostView_t("Host::T", T.extent(0), Y, Z);
-    dT  = LocalView_t("System::dT", T.extent(0), Y, Z);
-
-    Kokkos::deep_copy(T_h, T0);
-    Kokkos::deep_copy(T, T_h);
+    T_dv = DualView_t("System::T", X, Y, Z);
+    T    = T_dv.view_remote();
+    T_l  = T_dv.view_local();
+    dT   = LocalView_t("System::dT", T.extent(0), Y, Z);
+
+    Kokkos::deep_copy(T_dv.view_host(), T0);
+    T_dv.modify_host();
+    T_dv.sync_remote();
   }
 
   void print_help() {
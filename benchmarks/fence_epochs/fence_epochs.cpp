@@ -0,0 +1,154 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces.hpp>
+#include <mpi.h>
+#include <assert.h>
+#include <string>
+
+/* Bulk-synchronous exchange: every iteration puts a block to each of the
+ * next P PEs and fences. Compares passive-target windows (lock_all, flush
+ * and barrier) with active-target windows (MPI_Win_fence). */
+
+using RemoteSpace_t = Kokkos::Experimental::MPISpace;
+using RemoteView_t  = Kokkos::View<double *, RemoteSpace_t>;
+using HostView_t    = Kokkos::View<double *, Kokkos::HostSpace>;
+
+#define default_N 4096
+#define default_P 2
+#define default_iters 100
+
+std::string modes[3] = {"passive", "fence", "fence_nostore"};
+
+struct Args_t {
+  int mode  = 1;
+  int N     = default_N;
+  int P     = default_P;
+  int iters = default_iters;
+};
+
+void print_help() {
+  printf("Options (default):\n");
+  printf("  -N IARG: (%i) num elements per block\n", default_N);
+  printf("  -P IARG: (%i) num peers per PE\n", default_P);
+  printf("  -I IARG: (%i) num repititions\n", default_iters);
+  printf("  -M IARG: (%i) mode (epoch model)\n", 1);
+  printf("     modes:\n");
+  printf("       0: passive target (lock_all, flush, barrier)\n");
+  printf("       1: active target (MPI_Win_fence)\n");
+  printf("       2: active target with MPI_MODE_NOSTORE\n");
+}
+
+// read command line args
+bool read_args(int argc, char *argv[], Args_t &args) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-h") == 0) {
+      print_help();
+      return false;
+    }
+  }
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-N") == 0) args.N = atoi(argv[i + 1]);
+    if (strcmp(argv[i], "-P") == 0) args.P = atoi(argv[i + 1]);
+    if (strcmp(argv[i], "-I") == 0) args.iters = atoi(argv[i + 1]);
+    if (strcmp(argv[i], "-M") == 0) args.mode = atoi(argv[i + 1]);
+  }
+  return true;
+}
+
+void run(const Args_t &args) {
+  const int num_pes = Kokkos::Experimental::get_num_pes();
+  const int my_pe   = Kokkos::Experimental::get_my_pe();
+  const int peers   = std::min(args.P, num_pes - 1);
+  const size_t N    = args.N;
+
+  RemoteSpace_t space;
+  if (args.mode > 0)
+    space.impl_set_allocation_mode(Kokkos::Experimental::Fenced);
+  const int mpi_assert = args.mode == 2 ? MPI_MODE_NOSTORE : 0;
+
+  // Block k of every PE receives from the k-th previous PE
+  const size_t size = N * (peers > 0 ? peers : 1);
+  RemoteView_t v(Kokkos::view_alloc(space, "FenceEpochsView"), num_pes * size);
+  HostView_t h("FenceEpochsBuffer", N);
+  Kokkos::deep_copy(h, double(my_pe));
+
+  Kokkos::Experimental::RemoteSpaces::CommPlan plan;
+  for (int k = 0; k < peers; ++k) {
+    const int pe       = (my_pe + k + 1) % num_pes;
+    const size_t block = pe * size + k * N;
+    plan.record_put(Kokkos::subview(v, std::make_pair(block, block + N)), h);
+  }
+  RemoteSpace_t::fence();
+
+  Kokkos::Timer timer;
+  double time_a, time_b;
+  time_a = time_b = 0;
+  double time     = 0;
+
+  time_a = timer.seconds();
+  for (int i = 0; i < args.iters; i++) {
+    plan.execute();
+    RemoteSpace_t::fence(mpi_assert);
+  }
+  time_b = timer.seconds();
+  time += time_b - time_a;
+
+  double us_per_iter = 1e6 * time / args.iters;
+  double gbs = 1e-9 * sizeof(double) * N * peers * args.iters / time;
+  if (my_pe == 0)
+    printf("fence_epochs,%s,%lu,%i,%i,%lf,%lf,%lf\n",
+           modes[args.mode].c_str(), N, peers, args.iters, time, us_per_iter,
+           gbs);
+}
+
+int main(int argc, char *argv[]) {
+  int mpi_thread_level_available;
+  int mpi_thread_level_required = MPI_THREAD_MULTIPLE;
+
+#ifdef KOKKOS_ENABLE_DEFAULT_DEVICE_TYPE_SERIAL
+  mpi_thread_level_required = MPI_THREAD_SINGLE;
+#endif
+
+  MPI_Init_thread(&argc, &argv, mpi_thread_level_required,
+                  &mpi_thread_level_available);
+  assert(mpi_thread_level_available >= mpi_thread_level_required);
+
+  Kokkos::initialize(argc, argv);
+
+  do {
+    Args_t args;
+    if (!read_args(argc, argv, args)) {
+      break;
+    };
+
+    if (args.mode >= 0 && args.mode <= 2) {
+      run(args);
+    } else {
+      printf("invalid mode selected (%d)\n", args.mode);
+    }
+  } while (false);
+
+  Kokkos::fence();
+
+  Kokkos::finalize();
+  MPI_Finalize();
+  return 0;
+}
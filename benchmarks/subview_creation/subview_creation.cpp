@@ -0,0 +1,175 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces.hpp>
+#include <mpi.h>
+#include <assert.h>
+#include <string>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+using RemoteView_t  = Kokkos::View<double **, RemoteSpace_t>;
+using PlainView_t   = Kokkos::View<double **, Kokkos::LayoutRight>;
+using policy_t      = Kokkos::RangePolicy<size_t>;
+
+#define default_N 1024
+#define default_M 128
+#define default_iters 10
+
+std::string modes[2] = {"Kokkos::View", "Kokkos::RemoteView"};
+
+struct Args_t {
+  int mode  = 1;
+  int N     = default_N;
+  int M     = default_M;
+  int iters = default_iters;
+};
+
+void print_help() {
+  printf("Options (default):\n");
+  printf("  -N IARG: (%i) num rows (subviews created per iteration)\n",
+         default_N);
+  printf("  -C IARG: (%i) num columns\n", default_M);
+  printf("  -I IARG: (%i) num repititions\n", default_iters);
+  printf("  -M IARG: (%i) mode (view type)\n", 1);
+  printf("     modes:\n");
+  printf("       0: Kokkos (Normal)  View\n");
+  printf("       1: Kokkos Remote    View\n");
+}
+
+// read command line args
+bool read_args(int argc, char *argv[], Args_t &args) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-h") == 0) {
+      print_help();
+      return false;
+    }
+  }
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-N") == 0) args.N = atoi(argv[i + 1]);
+    if (strcmp(argv[i], "-C") == 0) args.M = atoi(argv[i + 1]);
+    if (strcmp(argv[i], "-I") == 0) args.iters = atoi(argv[i + 1]);
+    if (strcmp(argv[i], "-M") == 0) args.mode = atoi(argv[i + 1]);
+  }
+  return true;
+}
+
+/* Creates one row subview per work item and touches a single element
+ * so that the cost is dominated by the subview construction. */
+template <typename ViewType_t>
+struct SubviewCreation {
+  size_t N;  /* num rows */
+  size_t M;  /* num columns */
+  int iters; /* number of iterations */
+  int mode;  /* View type */
+
+  ViewType_t v;
+
+  SubviewCreation(Args_t args)
+      : N(args.N), M(args.M), iters(args.iters), mode(args.mode) {
+    size_t num_pes = Kokkos::Experimental::get_num_pes();
+    v = ViewType_t("SubviewCreationView", mode == 0 ? N : N * num_pes, M);
+  };
+
+  KOKKOS_FUNCTION
+  void operator()(const size_t i) const {
+    auto row = Kokkos::subview(v, i, Kokkos::ALL);
+    (void)row.extent(0);
+  }
+
+  void run() {
+    Kokkos::Timer timer;
+    double time_a, time_b;
+    time_a = time_b = 0;
+    double time     = 0;
+
+    // Subviews over rows owned by this PE
+    size_t start = mode == 0 ? 0 : Kokkos::Experimental::get_my_pe() * N;
+
+    time_a = timer.seconds();
+    for (int i = 0; i < iters; i++) {
+      Kokkos::parallel_for("subview_creation", policy_t(start, start + N),
+                           *this);
+      Kokkos::fence();
+    }
+    time_b = timer.seconds();
+    time += time_b - time_a;
+
+    double ns_per_subview = 1e9 * time / (double(N) * iters);
+    printf("subview_creation,%s,%lu,%lu,%i,%lf,%lf\n", modes[mode].c_str(), N,
+           M, iters, time, ns_per_subview);
+  }
+};
+
+int main(int argc, char *argv[]) {
+  int mpi_thread_level_available;
+  int mpi_thread_level_required = MPI_THREAD_MULTIPLE;
+
+#ifdef KOKKOS_ENABLE_DEFAULT_DEVICE_TYPE_SERIAL
+  mpi_thread_level_required = MPI_THREAD_SINGLE;
+#endif
+
+  MPI_Init_thread(&argc, &argv, mpi_thread_level_required,
+                  &mpi_thread_level_available);
+  assert(mpi_thread_level_available >= mpi_thread_level_required);
+
+#ifdef KRS_ENABLE_SHMEMSPACE
+  shmem_init_thread(mpi_thread_level_required, &mpi_thread_level_available);
+  assert(mpi_thread_level_available >= mpi_thread_level_required);
+#endif
+
+#ifdef KRS_ENABLE_NVSHMEMSPACE
+  MPI_Comm mpi_comm;
+  nvshmemx_init_attr_t attr;
+  mpi_comm      = MPI_COMM_WORLD;
+  attr.mpi_comm = &mpi_comm;
+  nvshmemx_init_attr(NVSHMEMX_INIT_WITH_MPI_COMM, &attr);
+#endif
+
+  Kokkos::initialize(argc, argv);
+
+  do {
+    Args_t args;
+    if (!read_args(argc, argv, args)) {
+      break;
+    };
+
+    if (args.mode == 0) {
+      SubviewCreation<PlainView_t> s(args);
+      s.run();
+    } else if (args.mode == 1) {
+      SubviewCreation<RemoteView_t> s(args);
+      s.run();
+    } else {
+      printf("invalid mode selected (%d)\n", args.mode);
+    }
+  } while (false);
+
+  Kokkos::fence();
+
+  Kokkos::finalize();
+#ifdef KRS_ENABLE_SHMEMSPACE
+  shmem_finalize();
+#endif
+#ifdef KRS_ENABLE_NVSHMEMSPACE
+  nvshmem_finalize();
+#endif
+  MPI_Finalize();
+  return 0;
+}
@@ -34,7 +34,7 @@ class RemoteSpacesSpecializeTag {};
 
 using RemoteSpaceSpecializeTag = RemoteSpacesSpecializeTag<>;
 
-enum RemoteSpaces_MemoryAllocationMode : int { Symmetric, Cached };
+enum RemoteSpaces_MemoryAllocationMode : int { Symmetric, Cached, Fenced };
 }  // namespace Experimental
 }  // namespace Kokkos
 
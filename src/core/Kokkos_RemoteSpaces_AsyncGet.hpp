@@ -0,0 +1,143 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_ASYNCGET_HPP
+#define KOKKOS_REMOTESPACES_ASYNCGET_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Handle of a split-phase read of one remote view element.
+ *
+ * The read is issued non-blocking at construction (or start()) and the
+ * value is returned by wait(), so a thread can keep many reads in flight
+ * and pay roughly one round-trip for all of them. The value lives in the
+ * handle, which therefore can be neither copied nor moved; the destructor
+ * completes a pending read. Reads bypass the read-only cache and RACERlib
+ * but observe the calling thread's buffered stores and atomic adds.
+ * Not supported on fenced or neighbor-synchronized MPISpace allocations.
+ */
+template <class T>
+class AsyncValue {
+ public:
+  using value_type = std::remove_const_t<T>;
+
+  AsyncValue() = default;
+  AsyncValue(const AsyncValue &) = delete;
+  AsyncValue &operator=(const AsyncValue &) = delete;
+
+  template <class ViewType, class... Is>
+  AsyncValue(const ViewType &view, const Is &... is) {
+    start(view, is...);
+  }
+
+  ~AsyncValue() { wait(); }
+
+  /** \brief  Issues the read of view(is...), completing any earlier one */
+  template <class ViewType, class... Is>
+  void start(const ViewType &view, const Is &... is) {
+    static_assert(Is_View_Of_Type_RemoteSpaces<ViewType>::value,
+                  "get_async requires a remote view");
+    static_assert(
+        std::is_same<std::remove_const_t<typename ViewType::value_type>,
+                     value_type>::value,
+        "Value type mismatch");
+    wait();
+    const auto element = view(is...);
+#ifdef KRS_ENABLE_MPISPACE
+    // Gets in active-target epochs only complete at the end of the epoch
+    if (Kokkos::Impl::mpi_window_is_fenced(*element.loc))
+      Kokkos::Impl::throw_runtime_exception(
+          "get_async is not supported on fenced or neighbor-synchronized "
+          "MPISpace allocations");
+    const size_t byte_offset = sizeof(Kokkos::Impl::SharedAllocationHeader) +
+                               size_t(element.offset) * sizeof(value_type);
+    // The read observes the calling thread's buffered stores and adds
+    Kokkos::Impl::mpi_flush_combined_stores(*element.loc, element.pe,
+                                            byte_offset, sizeof(value_type));
+    Kokkos::Impl::mpi_flush_aggregated_adds<value_type>(
+        *element.loc, element.pe, byte_offset);
+    Kokkos::Impl::mpi_block_get_nbi(&m_value, byte_offset, sizeof(value_type),
+                                    element.pe, *element.loc, &m_request);
+#else
+    // The read observes the calling thread's buffered stores and adds
+    Kokkos::Impl::shmem_flush_combined_stores(element.ptr, element.pe,
+                                              sizeof(value_type));
+    Kokkos::Impl::shmem_flush_aggregated_adds(element.ptr, element.pe);
+    Kokkos::Impl::shmem_block_get_nbi(&m_value, element.ptr,
+                                      sizeof(value_type), element.pe);
+#endif
+    m_pending = true;
+  }
+
+  bool pending() const { return m_pending; }
+
+  /** \brief  Completes the read and returns the value; idempotent */
+  value_type wait() {
+    if (m_pending) {
+#ifdef KRS_ENABLE_MPISPACE
+      MPI_Wait(&m_request, MPI_STATUS_IGNORE);
+#else
+      // Completes all reads of the calling PE
+      shmem_quiet();
+#endif
+      m_pending = false;
+    }
+    return m_value;
+  }
+
+ private:
+  value_type m_value = value_type();
+#ifdef KRS_ENABLE_MPISPACE
+  MPI_Request m_request = MPI_REQUEST_NULL;
+#endif
+  bool m_pending = false;
+};
+
+/** \brief  Starts reading view(is...) and returns the handle of the read */
+template <class ViewType, class... Is>
+AsyncValue<typename ViewType::value_type> get_async(const ViewType &view,
+                                                     const Is &... is) {
+  return AsyncValue<typename ViewType::value_type>(view, is...);
+}
+
+template <class T>
+typename AsyncValue<T>::value_type wait(AsyncValue<T> &handle) {
+  return handle.wait();
+}
+
+/** \brief  Completes the reads of n handles */
+template <class T>
+void wait_all(AsyncValue<T> *handles, const size_t n) {
+  for (size_t k = 0; k < n; ++k) handles[k].wait();
+}
+
+/** \brief  Completes the reads of all handles given */
+template <class... Ts>
+void wait_all(AsyncValue<Ts> &... handles) {
+  (handles.wait(), ...);
+}
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_ASYNCGET_HPP
@@ -0,0 +1,195 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_ATOMICAGGREGATION_HPP
+#define KOKKOS_REMOTESPACES_ATOMICAGGREGATION_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/* Distinct elements buffered per destination before it is flushed */
+#ifndef KRS_ATOMIC_AGGREGATION_ENTRIES
+#define KRS_ATOMIC_AGGREGATION_ENTRIES 1024
+#endif
+
+/* Number of destinations buffered concurrently by each thread and type */
+#ifndef KRS_ATOMIC_AGGREGATION_BATCHES
+#define KRS_ATOMIC_AGGREGATION_BATCHES 8
+#endif
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+/* Atomic adds to one segment (allocation) on one PE, merged by offset */
+template <class T>
+struct RemoteSpaces_AtomicBatch {
+  using flush_type = void (*)(const RemoteSpaces_AtomicBatch &);
+
+  static constexpr size_t capacity  = KRS_ATOMIC_AGGREGATION_ENTRIES;
+  static constexpr size_t num_slots = 2 * capacity;
+
+  int pe              = -1;
+  int64_t segment     = 0;
+  size_t count        = 0;
+  flush_type flush_fn = nullptr;
+  std::vector<size_t> offsets;
+  std::vector<T> values;
+
+  RemoteSpaces_AtomicBatch()
+      : offsets(capacity), values(capacity), m_slots(num_slots, -1) {}
+
+  /* Adds val to the entry of offset; false if a new entry does not fit */
+  bool add(size_t offset, const T &val) {
+    size_t slot = first_slot(offset);
+    while (m_slots[slot] >= 0) {
+      if (offsets[m_slots[slot]] == offset) {
+        values[m_slots[slot]] += val;
+        return true;
+      }
+      slot = (slot + 1) % num_slots;
+    }
+    if (count == capacity) return false;
+    m_slots[slot]  = int(count);
+    offsets[count] = offset;
+    values[count]  = val;
+    ++count;
+    return true;
+  }
+
+  /* Whether an entry of offset is buffered */
+  bool contains(size_t offset) const {
+    size_t slot = first_slot(offset);
+    while (m_slots[slot] >= 0) {
+      if (offsets[m_slots[slot]] == offset) return true;
+      slot = (slot + 1) % num_slots;
+    }
+    return false;
+  }
+
+  void flush() {
+    if (count == 0) return;
+    flush_fn(*this);
+    std::fill(m_slots.begin(), m_slots.end(), -1);
+    count = 0;
+  }
+
+ private:
+  static size_t first_slot(size_t offset) {
+    return (offset * 0x9E3779B97F4A7C15ull >> 17) % num_slots;
+  }
+
+  std::vector<int> m_slots;
+};
+
+/* Per-thread aggregation of remote atomic adds.
+ *
+ * Adds are buffered per destination and merged with earlier adds to the
+ * same element; a destination is flushed through its backend function as
+ * one vector update when its batch is full or another destination maps to
+ * the same batch. Other atomic operations of a thread flush its batch
+ * holding the element first. Batches of all threads are flushed by
+ * flush_all, which the backends call at fence and before freeing an
+ * allocation, while no kernel is running. */
+class RemoteSpaces_AtomicAggregator {
+ public:
+  template <class T>
+  static void add(int pe, int64_t segment, size_t offset, const T &val,
+                  typename RemoteSpaces_AtomicBatch<T>::flush_type flush_fn) {
+    auto &batch = local<T>().batches[pe % KRS_ATOMIC_AGGREGATION_BATCHES];
+    if (batch.count && (batch.pe != pe || batch.segment != segment))
+      batch.flush();
+    if (batch.count == 0) {
+      batch.pe       = pe;
+      batch.segment  = segment;
+      batch.flush_fn = flush_fn;
+    }
+    if (!batch.add(offset, val)) {
+      batch.flush();
+      batch.add(offset, val);
+    }
+  }
+
+  /* Flushes the calling thread's batch if it holds an add to offset of
+   * segment on pe. Returns whether a batch was flushed. */
+  template <class T>
+  static bool flush(int pe, int64_t segment, size_t offset) {
+    auto &batch = local<T>().batches[pe % KRS_ATOMIC_AGGREGATION_BATCHES];
+    if (batch.count == 0 || batch.pe != pe || batch.segment != segment ||
+        !batch.contains(offset))
+      return false;
+    batch.flush();
+    return true;
+  }
+
+  static void flush_all() {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    for (auto *buffers : registry()) buffers->flush();
+  }
+
+ private:
+  struct ThreadBuffersBase {
+    virtual ~ThreadBuffersBase() = default;
+    virtual void flush()         = 0;
+  };
+
+  template <class T>
+  struct ThreadBuffers : ThreadBuffersBase {
+    std::vector<RemoteSpaces_AtomicBatch<T>> batches;
+
+    ThreadBuffers() : batches(KRS_ATOMIC_AGGREGATION_BATCHES) {
+      std::lock_guard<std::mutex> lock(registry_mutex());
+      registry().push_back(this);
+    }
+
+    ~ThreadBuffers() {
+      std::lock_guard<std::mutex> lock(registry_mutex());
+      flush();
+      auto &threads = registry();
+      threads.erase(std::find(threads.begin(), threads.end(), this));
+    }
+
+    void flush() override {
+      for (auto &batch : batches) batch.flush();
+    }
+  };
+
+  template <class T>
+  static ThreadBuffers<T> &local() {
+    thread_local ThreadBuffers<T> buffers;
+    return buffers;
+  }
+
+  static std::vector<ThreadBuffersBase *> &registry() {
+    static std::vector<ThreadBuffersBase *> threads;
+    return threads;
+  }
+
+  static std::mutex &registry_mutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_ATOMICAGGREGATION_HPP
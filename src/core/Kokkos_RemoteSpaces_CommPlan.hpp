@@ -0,0 +1,136 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_COMMPLAN_HPP
+#define KOKKOS_REMOTESPACES_COMMPLAN_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Recorded set of block transfers replayed every iteration.
+ *
+ * record_get() and record_put() resolve a copy between a remote view and a
+ * local view of the same layout into block transfers, one per PE the
+ * remote view spans, with target PE, window displacement or symmetric
+ * address, size and the windows to flush computed once. start() issues
+ * all recorded transfers as non-blocking gets and puts without touching
+ * the views again and wait() completes them, so a replay costs one call
+ * per transfer and one completion per plan. Remote views that belong to
+ * this PE are recorded as transfers to self.
+ *
+ * The plan keeps raw addresses: the recorded views must stay allocated and
+ * may not be resized while it is in use. Like deep_copy_async, a replay does
+ * not synchronize with other PEs; order it with RemoteSpace fences.
+ * Transfers on fenced MPISpace allocations complete at the next fence.
+ */
+class CommPlan {
+ public:
+  CommPlan() = default;
+
+  /** \brief  Records a copy from remote view src into local view dst */
+  template <class LocalView, class RemoteView>
+  void record_get(const LocalView &dst, const RemoteView &src) {
+    static_assert(std::is_same<typename LocalView::value_type,
+                               typename LocalView::non_const_value_type>::value,
+                  "CommPlan::record_get requires non-const destination type");
+    check(dst, src);
+    Kokkos::Impl::resolve_block_transfers(m_transfers, m_pending, src,
+                                          dst.data(), true);
+  }
+
+  /** \brief  Records a copy from local view src into remote view dst */
+  template <class RemoteView, class LocalView>
+  void record_put(const RemoteView &dst, const LocalView &src) {
+    static_assert(
+        std::is_same<typename RemoteView::value_type,
+                     typename RemoteView::non_const_value_type>::value,
+        "CommPlan::record_put requires non-const destination type");
+    check(src, dst);
+    Kokkos::Impl::resolve_block_transfers(
+        m_transfers, m_pending, dst,
+        const_cast<typename RemoteView::value_type *>(src.data()), false);
+  }
+
+  /** \brief  Number of recorded block transfers */
+  size_t size() const { return m_transfers.size(); }
+
+  /** \brief  Issues all recorded transfers */
+  void start() {
+    Kokkos::fence("Kokkos::Experimental::RemoteSpaces::CommPlan::start");
+    for (const auto &t : m_transfers) m_pending.issue(t);
+  }
+
+  /** \brief  Completes the transfers issued by start() */
+  void wait() { m_pending.wait(); }
+
+  /** \brief  start() followed by wait() */
+  void execute() {
+    start();
+    wait();
+  }
+
+ private:
+  template <class LocalView, class RemoteView>
+  static void check(const LocalView &local, const RemoteView &remote) {
+    static_assert(Is_View_Of_Type_RemoteSpaces<RemoteView>::value &&
+                      !Is_View_Of_Type_RemoteSpaces<LocalView>::value,
+                  "CommPlan records copies between a remote and a local view");
+    static_assert(
+        std::is_same<typename LocalView::non_const_value_type,
+                     typename RemoteView::non_const_value_type>::value,
+        "CommPlan requires views of the same value type");
+    static_assert(unsigned(LocalView::rank) == unsigned(RemoteView::rank),
+                  "CommPlan requires views of equal rank");
+    static_assert(Kokkos::SpaceAccessibility<
+                      Kokkos::HostSpace,
+                      typename LocalView::memory_space>::accessible,
+                  "CommPlan requires a host accessible local view");
+
+    int64_t local_strides[LocalView::rank + 1];
+    int64_t remote_strides[RemoteView::rank + 1];
+    local.stride(local_strides);
+    remote.stride(remote_strides);
+    bool valid = local.span_is_contiguous() && remote.span_is_contiguous();
+    for (unsigned r = 0; r < LocalView::rank; ++r)
+      valid = valid && local.extent(r) == remote.extent(r) &&
+              local_strides[r] == remote_strides[r];
+    if (!valid) {
+      std::string message(
+          "Error: CommPlan requires contiguous views of matching extents and "
+          "strides: ");
+      message += local.label();
+      message += " ";
+      message += remote.label();
+      Kokkos::Impl::throw_runtime_exception(message);
+    }
+  }
+
+  std::vector<Kokkos::Impl::RemoteSpaces_BlockTransfer> m_transfers;
+  Kokkos::Impl::RemoteSpaces_PendingTransfers m_pending;
+};
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_COMMPLAN_HPP
@@ -20,6 +20,7 @@
 #define KOKKOS_REMOTESPACES_DEEPCOPY_HPP
 
 #include <Kokkos_RemoteSpaces.hpp>
+#include <Kokkos_RemoteSpaces_ParallelCopy.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -553,7 +554,7 @@ template <class ExecutionSpace, class DstType, class SrcType>
 void view_copy_RemoteSpaces(
     const ExecutionSpace& space, const DstType& dst, const SrcType& src,
     typename std::enable_if_t<(
-        std::is_same<typename SrcType::traits::specialize,
+        std::is_same<typename DstType::traits::specialize,
                      Kokkos::Experimental::RemoteSpaceSpecializeTag>::value ||
         std::is_same<typename SrcType::traits::specialize,
                      Kokkos::Experimental::RemoteSpaceSpecializeTag>::value)>* =
@@ -743,6 +744,15 @@ inline void contiguous_fill(
                                         Kokkos::AnonymousSpace>>,
       Kokkos::MemoryTraits<0>>;
 
+  // Host partitions are filled in chunks on the raw pointer
+  if constexpr (Kokkos::SpaceAccessibility<ExecutionSpace,
+                                           Kokkos::HostSpace>::accessible &&
+                std::is_trivially_copyable<
+                    typename ViewType::value_type>::value) {
+    remote_spaces_parallel_fill(exec_space, dst.data(), dst.size(), value);
+    return;
+  }
+
   ViewTypeFlat dst_flat(dst.data(), dst.size());
   if (dst.span() < static_cast<size_t>(std::numeric_limits<int>::max())) {
     Kokkos::Impl::ViewFill_RemoteSpaces<ViewTypeFlat, Kokkos::LayoutRight,
@@ -763,13 +773,18 @@ struct ZeroMemset_RemoteSpaces {
       typename std::enable_if_t<
           Kokkos::Experimental::Is_View_Of_Type_RemoteSpaces<
               ViewType>::value>* = nullptr) {
-    contiguous_fill(exec_space, dst, value);
+    if constexpr (Kokkos::SpaceAccessibility<ExecutionSpace,
+                                             Kokkos::HostSpace>::accessible)
+      remote_spaces_parallel_memset(
+          exec_space, dst.data(),
+          dst.size() * sizeof(typename ViewType::value_type));
+    else
+      contiguous_fill(exec_space, dst, value);
   }
 
   ZeroMemset_RemoteSpaces(const ViewType& dst,
-                          typename ViewType::const_value_type& value) {
-    contiguous_fill(ExecutionSpace(), dst, value);
-  }
+                          typename ViewType::const_value_type& value)
+      : ZeroMemset_RemoteSpaces(ExecutionSpace(), dst, value) {}
 };
 
 template <typename ExecutionSpace, class DT, class... DP>
@@ -787,7 +802,8 @@ contiguous_fill_or_memset(
 // leading to the significant performance issues
 #ifndef KOKKOS_ARCH_A64FX
   if (Impl::is_zero_byte(value))
-    ZeroMemset<ExecutionSpace, View<DT, DP...>>(exec_space, dst, value);
+    ZeroMemset_RemoteSpaces<ExecutionSpace, View<DT, DP...>>(exec_space, dst,
+                                                             value);
   else
 #endif
     contiguous_fill(exec_space, dst, value);
@@ -825,7 +841,7 @@ contiguous_fill_or_memset(
 // leading to the significant performance issues
 #ifndef KOKKOS_ARCH_A64FX
   if (Impl::is_zero_byte(value))
-    ZeroMemset<exec_space_type, View<DT, DP...>>(dst, value);
+    ZeroMemset_RemoteSpaces<exec_space_type, View<DT, DP...>>(dst, value);
   else
 #endif
     contiguous_fill(exec_space_type(), dst, value);
@@ -881,6 +897,34 @@ inline void deep_copy(const View<DT, DP...>& dst,
                              typename ViewType::value_type>::value,
                 "deep_copy requires non-const type");
 
+  // Every PE owns its block of a global or partitioned view and fills it
+  // through the raw pointer below. Views into the blocks of other PEs are
+  // written through the remote accessor instead.
+  const auto& props  = dst.impl_map().remote_view_props;
+  const size_t block = dst.impl_map().get_R0_size();
+  bool is_remote     = !Kokkos::Experimental::Impl::is_local_view(dst);
+  if constexpr (ViewType::rank > 0)
+    is_remote |= props.using_local_indexing && block > 0 &&
+                 props.R0_offset % block + dst.extent(0) > block;
+
+  if (is_remote) {
+    if constexpr (ViewType::rank == 0 ||
+                  Kokkos::Experimental::Is_Partitioned_Layout<ViewType>::value)
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::deep_copy: scalar fill of a remote partition is only "
+          "supported for global layouts");
+    else
+      Kokkos::Impl::ViewFill_RemoteSpaces<ViewType, Kokkos::LayoutRight,
+                                          exec_space_type, ViewType::rank,
+                                          int64_t>(dst, value,
+                                                   exec_space_type());
+    Kokkos::fence("Kokkos::deep_copy: scalar copy, post copy fence");
+    if (Kokkos::Tools::Experimental::get_callbacks().end_deep_copy != nullptr) {
+      Kokkos::Profiling::endDeepCopy();
+    }
+    return;
+  }
+
   // If contiguous we can simply do a 1D flat loop or use memset
   if (dst.span_is_contiguous()) {
     Impl::contiguous_fill_or_memset(dst, value);
@@ -0,0 +1,319 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_DEEPCOPYASYNC_HPP
+#define KOKKOS_REMOTESPACES_DEEPCOPYASYNC_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Impl {
+
+/* A block transfer between local memory and one PE, with its target
+ * resolved to a window displacement (MPI) or symmetric address (SHMEM) */
+struct RemoteSpaces_BlockTransfer {
+  void *local;
+  size_t nbytes;
+  int pe;
+  bool is_get;
+#ifdef KRS_ENABLE_MPISPACE
+  MPIAccessLocation loc;
+  size_t byte_offset;
+#else
+  void *symmetric;
+#endif
+};
+
+/* One-sided transfers issued by deep_copy_async that have not completed.
+ * The windows to flush are resolved when transfers are recorded, so that
+ * issuing a transfer only posts it. */
+struct RemoteSpaces_PendingTransfers {
+#ifdef KRS_ENABLE_MPISPACE
+  std::vector<MPI_Request> requests;
+  std::vector<MPI_Win> put_wins;
+  bool puts_issued = false;
+
+  void record(const RemoteSpaces_BlockTransfer &t) {
+    // Puts on fenced windows complete at MPISpace::fence
+    if (t.is_get || mpi_window_is_fenced(t.loc)) return;
+    if (std::find(put_wins.begin(), put_wins.end(), t.loc.win) ==
+        put_wins.end())
+      put_wins.push_back(t.loc.win);
+  }
+
+  void issue(const RemoteSpaces_BlockTransfer &t) {
+    requests.emplace_back();
+    if (t.is_get) {
+      mpi_block_get_nbi(t.local, t.byte_offset, t.nbytes, t.pe, t.loc,
+                        &requests.back());
+    } else {
+      mpi_block_put_nbi(t.local, t.byte_offset, t.nbytes, t.pe, t.loc,
+                        &requests.back());
+      puts_issued = true;
+    }
+  }
+
+  void wait() {
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    requests.clear();
+    // Completed puts are only local, flush to make them visible remotely
+    if (puts_issued)
+      for (auto &win : put_wins) MPI_Win_flush_all(win);
+    puts_issued = false;
+  }
+#else
+  bool outstanding = false;
+
+  void record(const RemoteSpaces_BlockTransfer &) {}
+
+  void issue(const RemoteSpaces_BlockTransfer &t) {
+    if (t.is_get)
+      shmem_block_get_nbi(t.local, t.symmetric, t.nbytes, t.pe);
+    else
+      shmem_block_put_nbi(t.symmetric, t.local, t.nbytes, t.pe);
+    outstanding = true;
+  }
+
+  void wait() {
+    if (outstanding) shmem_quiet();
+    outstanding = false;
+  }
+#endif
+  // Local buffers must not be released while transfers are in flight
+  ~RemoteSpaces_PendingTransfers() { wait(); }
+};
+
+/* Resolves the block transfers between the remote view and local memory of
+ * the same layout, one per PE the view spans, and records them in pending */
+template <class RemoteView>
+void resolve_block_transfers(std::vector<RemoteSpaces_BlockTransfer> &out,
+                             RemoteSpaces_PendingTransfers &pending,
+                             const RemoteView &remote,
+                             typename RemoteView::non_const_value_type *local,
+                             const bool is_get) {
+  using value_type  = typename RemoteView::non_const_value_type;
+  using placement_t = RemoteSpaces_Dim0Placement<RemoteView>;
+
+  auto transfer = [&](const int pe, const size_t remote_offset,
+                      const size_t local_offset, const size_t elems) {
+    RemoteSpaces_BlockTransfer t;
+    t.local  = local + local_offset;
+    t.nbytes = elems * sizeof(value_type);
+    t.pe     = pe;
+    t.is_get = is_get;
+    if (t.nbytes == 0) return;
+#ifdef KRS_ENABLE_MPISPACE
+    const auto &loc = remote.impl_map().handle().loc;
+    t.loc           = loc;
+    t.byte_offset   = sizeof(SharedAllocationHeader) +
+                      (loc.offset + remote_offset) * sizeof(value_type);
+#else
+    t.symmetric = const_cast<value_type *>(remote.impl_map().handle().ptr) +
+                  remote_offset;
+#endif
+    pending.record(t);
+    out.push_back(t);
+  };
+
+  const placement_t rows(remote);
+  if (!rows.split) {
+    transfer(rows.pe, 0, 0, remote.span());
+    return;
+  }
+  if (!placement_t::is_row_contiguous)
+    Kokkos::Impl::throw_runtime_exception(
+        "Error: block transfers of a view spanning multiple PEs require "
+        "contiguous dim0 rows");
+  for (size_t i = 0; i < remote.extent(0);) {
+    size_t n = remote.extent(0) - i;
+    n        = rows.rows_on_pe(i) < n ? rows.rows_on_pe(i) : n;
+    transfer(rows.pe_of(i), rows.offset_of(i), i * rows.row_elems,
+             n * rows.row_elems);
+    i += n;
+  }
+}
+
+/* Issues non-blocking block transfers between the remote view and local
+ * memory of the same layout, one per PE the view spans. */
+template <class RemoteView>
+void deep_copy_async_transfers(
+    RemoteSpaces_PendingTransfers &pending, const RemoteView &remote,
+    typename RemoteView::non_const_value_type *local, const bool is_get) {
+  std::vector<RemoteSpaces_BlockTransfer> transfers;
+  resolve_block_transfers(transfers, pending, remote, local, is_get);
+  for (const auto &t : transfers) pending.issue(t);
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Completion handle of deep_copy_async.
+ *
+ * wait() completes the one-sided transfers of the copy and fences the
+ * execution space instance it was issued on. Copies of a handle share its
+ * state; outstanding transfers are completed when the last copy goes away.
+ */
+template <class ExecSpace>
+class DeepCopyHandle {
+ public:
+  DeepCopyHandle() = default;
+
+  DeepCopyHandle(
+      const ExecSpace &exec,
+      std::shared_ptr<Kokkos::Impl::RemoteSpaces_PendingTransfers> pending)
+      : m_exec(exec), m_pending(std::move(pending)) {}
+
+  /** \brief  Completes the copy; idempotent */
+  void wait() const {
+    if (!m_pending) return;
+    m_pending->wait();
+    m_exec.fence("Kokkos::Experimental::RemoteSpaces::DeepCopyHandle::wait");
+  }
+
+  /** \brief  Execution space instance the copy was issued on */
+  const ExecSpace &execution_space() const { return m_exec; }
+
+ private:
+  ExecSpace m_exec;
+  std::shared_ptr<Kokkos::Impl::RemoteSpaces_PendingTransfers> m_pending;
+};
+
+/** \brief  Starts a deep copy between views of which at least one is a
+ * remote view and returns its completion handle.
+ *
+ * Copies between views of equal type and layout with contiguous spans are
+ * issued as non-blocking block transfers, one per PE, after fencing exec
+ * so that they observe work already submitted to it. Copies between local
+ * memory are enqueued on exec and all other copies run as a kernel on
+ * exec. No global fence is issued; dst must not be read and src must not
+ * be modified before wait() returns. Block transfers on fenced MPISpace
+ * allocations complete at the next MPISpace::fence instead.
+ */
+template <class ExecSpace, class DT, class... DP, class ST, class... SP>
+DeepCopyHandle<ExecSpace> deep_copy_async(
+    const ExecSpace &exec, const View<DT, DP...> &dst,
+    const View<ST, SP...> &src,
+    std::enable_if_t<Kokkos::is_execution_space<ExecSpace>::value &&
+                     (Is_View_Of_Type_RemoteSpaces<View<DT, DP...>>::value ||
+                      Is_View_Of_Type_RemoteSpaces<View<ST, SP...>>::value)>
+        * = nullptr) {
+  using dst_type = View<DT, DP...>;
+  using src_type = View<ST, SP...>;
+
+  static_assert(std::is_same<typename dst_type::value_type,
+                             typename dst_type::non_const_value_type>::value,
+                "deep_copy_async requires non-const destination type");
+  static_assert(unsigned(dst_type::rank) == unsigned(src_type::rank),
+                "deep_copy_async requires Views of equal rank");
+
+  for (unsigned r = 0; r < dst_type::rank; ++r) {
+    if (dst.extent(r) != src.extent(r)) {
+      std::string message(
+          "Error: Kokkos::deep_copy_async extents of views don't match: ");
+      message += dst.label();
+      message += " ";
+      message += src.label();
+      Kokkos::Impl::throw_runtime_exception(message);
+    }
+  }
+
+  auto pending =
+      std::make_shared<Kokkos::Impl::RemoteSpaces_PendingTransfers>();
+  DeepCopyHandle<ExecSpace> handle(exec, pending);
+
+  if (dst.data() == nullptr || src.data() == nullptr || dst.span() == 0)
+    return handle;
+
+  int64_t dst_strides[dst_type::rank + 1];
+  int64_t src_strides[src_type::rank + 1];
+  dst.stride(dst_strides);
+  src.stride(src_strides);
+  bool equal_strides = true;
+  for (unsigned r = 0; r < dst_type::rank; ++r)
+    equal_strides = equal_strides && dst_strides[r] == src_strides[r];
+
+  constexpr bool host_accessible =
+      Kokkos::SpaceAccessibility<
+          Kokkos::HostSpace, typename dst_type::memory_space>::accessible &&
+      Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                 typename src_type::memory_space>::accessible;
+
+  const bool bytewise =
+      std::is_same<typename dst_type::value_type,
+                   typename src_type::non_const_value_type>::value &&
+      (std::is_same<typename dst_type::array_layout,
+                    typename src_type::array_layout>::value ||
+       Is_Partitioned_Layout<dst_type>::value !=
+           Is_Partitioned_Layout<src_type>::value ||
+       dst_type::rank == 1) &&
+      dst.span_is_contiguous() && src.span_is_contiguous() && equal_strides &&
+      host_accessible;
+
+  if (!bytewise) {
+    Kokkos::Impl::view_copy_RemoteSpaces(exec, dst, src);
+    return handle;
+  }
+
+  const size_t nbytes  = dst.span() * sizeof(typename dst_type::value_type);
+  const bool dst_local = Kokkos::Experimental::Impl::is_local_view(dst);
+  const bool src_local = Kokkos::Experimental::Impl::is_local_view(src);
+
+  if (dst_local && src_local) {
+    if ((void *)dst.data() != (void *)src.data())
+      Kokkos::Impl::DeepCopy<Kokkos::HostSpace, Kokkos::HostSpace, ExecSpace>(
+          exec, dst.data(), src.data(), nbytes);
+    return handle;
+  }
+
+  if (!dst_local && !src_local) {
+    std::string message(
+        "Error: Kokkos::deep_copy_async with no available copy mechanism "
+        "between remote views: ");
+    message += src.label();
+    message += " to ";
+    message += dst.label();
+    Kokkos::Impl::throw_runtime_exception(message);
+  }
+
+  exec.fence(
+      "Kokkos::Experimental::RemoteSpaces::deep_copy_async: order transfers "
+      "after submitted work");
+  if constexpr (Is_View_Of_Type_RemoteSpaces<dst_type>::value) {
+    if (!dst_local)
+      Kokkos::Impl::deep_copy_async_transfers(
+          *pending, dst,
+          const_cast<typename dst_type::value_type *>(src.data()), false);
+  }
+  if constexpr (Is_View_Of_Type_RemoteSpaces<src_type>::value) {
+    if (!src_local)
+      Kokkos::Impl::deep_copy_async_transfers(*pending, src, dst.data(), true);
+  }
+  return handle;
+}
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_DEEPCOPYASYNC_HPP
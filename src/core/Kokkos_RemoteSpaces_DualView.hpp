@@ -0,0 +1,209 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_DUALVIEW_HPP
+#define KOKKOS_REMOTESPACES_DUALVIEW_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+/* Layout of the local partition of a remote view */
+template <class Layout>
+struct RemoteSpaces_LocalLayout {
+  using type = Layout;
+};
+
+template <>
+struct RemoteSpaces_LocalLayout<PartitionedLayoutLeft> {
+  using type = Kokkos::LayoutLeft;
+};
+
+template <>
+struct RemoteSpaces_LocalLayout<PartitionedLayoutRight> {
+  using type = Kokkos::LayoutRight;
+};
+
+/* Sorted, disjoint dim0 ranges pending a copy */
+class RemoteSpaces_DirtyRanges {
+ public:
+  using range_type = Kokkos::pair<size_t, size_t>;
+
+  void insert(range_type range) {
+    if (range.first >= range.second) return;
+    // Merge with every overlapping or adjacent range
+    auto it = std::lower_bound(
+        m_ranges.begin(), m_ranges.end(), range,
+        [](const range_type &a, const range_type &b) {
+          return a.second < b.first;
+        });
+    while (it != m_ranges.end() && it->first <= range.second) {
+      range.first  = std::min(range.first, it->first);
+      range.second = std::max(range.second, it->second);
+      it           = m_ranges.erase(it);
+    }
+    m_ranges.insert(it, range);
+  }
+
+  bool empty() const { return m_ranges.empty(); }
+  const std::vector<range_type> &ranges() const { return m_ranges; }
+  void clear() { m_ranges.clear(); }
+
+ private:
+  std::vector<range_type> m_ranges;
+};
+
+}  // namespace Impl
+
+namespace RemoteSpaces {
+
+/** \brief  Local partition of a remote view paired with a host mirror.
+ *
+ * view_local() aliases the memory this PE contributes to the remote view
+ * (no copy), view_host() is a host mirror of the same elements. Changes are
+ * flagged per dim0 range of the local partition with modify_local() and
+ * modify_host(); sync_remote() then copies only the host ranges flagged
+ * since the last sync into the partition and sync_local() only the flagged
+ * partition ranges into the host mirror.
+ *
+ * Remote writes by other PEs into this partition are not tracked; flag them
+ * with modify_local() after the RemoteSpace fence that completes them.
+ * Likewise, remote readers need a RemoteSpace fence after sync_remote().
+ */
+template <class RemoteViewType>
+class RemoteDualView {
+ public:
+  using remote_view_type = RemoteViewType;
+  using data_type        = typename RemoteViewType::non_const_data_type;
+  using array_layout     = typename Impl::RemoteSpaces_LocalLayout<
+      typename RemoteViewType::array_layout>::type;
+  using local_view_type =
+      Kokkos::View<data_type, array_layout,
+                   typename RemoteViewType::execution_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using host_mirror_type = typename local_view_type::HostMirror;
+  using range_type       = Impl::RemoteSpaces_DirtyRanges::range_type;
+
+  static_assert(Is_View_Of_Type_RemoteSpaces<RemoteViewType>::value,
+                "RemoteDualView requires a remote view");
+  static_assert(RemoteViewType::rank > 0,
+                "RemoteDualView requires a view of rank > 0");
+  static_assert(!std::is_same<typename RemoteViewType::array_layout,
+                              PartitionedLayoutStride>::value,
+                "RemoteDualView does not support strided layouts");
+
+  RemoteDualView() = default;
+
+  /** \brief  Allocates the remote view; arguments as for its constructor */
+  template <class... Args>
+  explicit RemoteDualView(const std::string &label, Args... args)
+      : RemoteDualView(RemoteViewType(label, args...)) {}
+
+  /** \brief  Pairs an existing remote view; throws if it is a subview */
+  explicit RemoteDualView(const RemoteViewType &view)
+      : m_remote(view),
+        m_local(alias_local(
+            view, std::make_index_sequence<RemoteViewType::rank>())),
+        m_host(Kokkos::create_mirror_view(m_local)),
+        m_state(std::make_shared<State>()) {}
+
+  remote_view_type view_remote() const { return m_remote; }
+
+  /** \brief  Local partition, indexed with local dim0 indices */
+  local_view_type view_local() const { return m_local; }
+
+  host_mirror_type view_host() const { return m_host; }
+
+  /** \brief  Flags local partition dim0 range as modified, all by default */
+  void modify_local(const range_type &range = range_type(0, ~size_t(0))) {
+    m_state->local_dirty.insert(clamp(range));
+  }
+
+  /** \brief  Flags host mirror dim0 range as modified, all by default */
+  void modify_host(const range_type &range = range_type(0, ~size_t(0))) {
+    m_state->host_dirty.insert(clamp(range));
+  }
+
+  bool need_sync_remote() const { return !m_state->host_dirty.empty(); }
+  bool need_sync_local() const { return !m_state->local_dirty.empty(); }
+
+  /** \brief  Copies the modified host ranges into the local partition */
+  void sync_remote() {
+    for (const auto &range : m_state->host_dirty.ranges())
+      Kokkos::deep_copy(Kokkos::Impl::get_local_subview(m_local, range),
+                        Kokkos::Impl::get_local_subview(m_host, range));
+    m_state->host_dirty.clear();
+  }
+
+  /** \brief  Copies the modified local partition ranges into the host
+   * mirror */
+  void sync_local() {
+    for (const auto &range : m_state->local_dirty.ranges())
+      Kokkos::deep_copy(Kokkos::Impl::get_local_subview(m_host, range),
+                        Kokkos::Impl::get_local_subview(m_local, range));
+    m_state->local_dirty.clear();
+  }
+
+ private:
+  template <size_t... Rs>
+  static local_view_type alias_local(const RemoteViewType &view,
+                                     std::index_sequence<Rs...>) {
+    if (view.impl_map().remote_view_props.using_local_indexing)
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::RemoteSpaces::RemoteDualView: subviews are "
+          "not supported");
+    return local_view_type(view.data(), local_extent(view, Rs)...);
+  }
+
+  // Partitioned layouts hold one dim0 row per PE, global layouts R0_size
+  static size_t local_extent(const RemoteViewType &view, const size_t r) {
+    if (r > 0) return view.extent(r);
+    if constexpr (Is_Partitioned_Layout<RemoteViewType>::value)
+      return 1;
+    else
+      return view.impl_map().get_R0_size();
+  }
+
+  range_type clamp(const range_type &range) const {
+    const size_t n = m_local.extent(0);
+    return range_type(std::min(range.first, n), std::min(range.second, n));
+  }
+
+  // Shared by all copies, as the views are
+  struct State {
+    Impl::RemoteSpaces_DirtyRanges local_dirty;
+    Impl::RemoteSpaces_DirtyRanges host_dirty;
+  };
+
+  remote_view_type m_remote;
+  local_view_type m_local;
+  host_mirror_type m_host;
+  std::shared_ptr<State> m_state;
+};
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_DUALVIEW_HPP
@@ -0,0 +1,130 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_GATHERPLAN_HPP
+#define KOKKOS_REMOTESPACES_GATHERPLAN_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <mpi.h>
+
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Inspector-executor plan for irregular reads of a rank-1 remote
+ * view.
+ *
+ * The constructor (inspector) sorts and deduplicates a list of global
+ * indices by owning PE and exchanges the resulting receive lists, so that
+ * every PE knows which of its elements the others read. execute() then
+ * moves all requested elements with one MPI_Alltoallv into a local buffer
+ * with one entry per distinct index. A kernel reads index k of the
+ * original list as buffer(plan.remapped_indices()(k)). Subviews are not
+ * supported.
+ *
+ * Construction and execution are collective over all PEs.
+ */
+template <class ViewType>
+class GatherPlan {
+ public:
+  using value_type  = std::remove_const_t<typename ViewType::value_type>;
+  using size_type   = typename ViewType::size_type;
+  using remap_type  = Impl::RemoteSpaces_IndexLists::remap_type;
+  using buffer_type = Kokkos::View<value_type *, Kokkos::HostSpace>;
+
+  static_assert(Is_View_Of_Type_RemoteSpaces<ViewType>::value,
+                "GatherPlan requires a remote view");
+  static_assert(ViewType::rank == 1 && !Is_Partitioned_Layout<ViewType>::value,
+                "GatherPlan requires a rank-1 view with a global layout");
+
+  GatherPlan() = default;
+
+  template <class IndexView>
+  GatherPlan(const ViewType &view, const IndexView &indices) {
+    // Receive lists: local offsets on every owning PE
+    const Impl::RemoteSpaces_IndexLists lists(view, indices, "GatherPlan");
+    m_remap = lists.remap;
+
+    // Send lists: local offsets requested by every other PE
+    std::vector<int> send_counts, send_displs;
+    lists.exchange(send_counts, send_displs, m_send_offsets);
+
+    const int elem_bytes = sizeof(value_type);
+
+    m_send_counts = Impl::remote_spaces_to_bytes(send_counts, elem_bytes);
+    m_send_displs = Impl::remote_spaces_to_bytes(send_displs, elem_bytes);
+    m_recv_counts = Impl::remote_spaces_to_bytes(lists.counts, elem_bytes);
+    m_recv_displs = Impl::remote_spaces_to_bytes(lists.displs, elem_bytes);
+    m_send.resize(m_send_offsets.size());
+    m_buffer_size = lists.size();
+  }
+
+  /** \brief  Number of distinct indices, the required buffer extent */
+  size_type buffer_size() const { return m_buffer_size; }
+
+  /** \brief  Position in the buffer of every index of the original list */
+  remap_type remapped_indices() const { return m_remap; }
+
+  /** \brief  Allocates a buffer for execute() */
+  buffer_type create_buffer() const {
+    return buffer_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "GatherPlanBuffer"),
+        m_buffer_size);
+  }
+
+  /** \brief  Gathers the planned elements of view into buffer */
+  template <class BufferView>
+  void execute(const ViewType &view, const BufferView &buffer) const {
+    static_assert(
+        std::is_same<typename BufferView::memory_space,
+                     Kokkos::HostSpace>::value,
+        "GatherPlan buffers must be host accessible");
+    assert(buffer.extent(0) >= m_buffer_size);
+
+    // Requested local elements, packed in the order of the send lists
+    const value_type *local = view.data();
+    const int64_t *offsets  = m_send_offsets.data();
+    value_type *send        = m_send.data();
+    Kokkos::parallel_for(
+        "GatherPlan::pack",
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(
+            0, m_send.size()),
+        [=](const size_t k) { send[k] = local[offsets[k]]; });
+    Kokkos::fence();
+
+    MPI_Alltoallv(send, m_send_counts.data(), m_send_displs.data(),
+                  MPI_BYTE, buffer.data(), m_recv_counts.data(),
+                  m_recv_displs.data(), MPI_BYTE, MPI_COMM_WORLD);
+  }
+
+ private:
+  size_type m_buffer_size = 0;
+  remap_type m_remap;
+  std::vector<int64_t> m_send_offsets;
+  mutable std::vector<value_type> m_send;
+  std::vector<int> m_send_counts, m_send_displs;
+  std::vector<int> m_recv_counts, m_recv_displs;
+};
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_GATHERPLAN_HPP
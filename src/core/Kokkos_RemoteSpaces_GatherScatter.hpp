@@ -0,0 +1,164 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_GATHERSCATTER_HPP
+#define KOKKOS_REMOTESPACES_GATHERSCATTER_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+template <class ViewType, class IndexView>
+void check_gather_scatter_args(const ViewType &view, const IndexView &,
+                               const char *caller) {
+  static_assert(Is_View_Of_Type_RemoteSpaces<ViewType>::value,
+                "remote_gather/remote_scatter require a remote view");
+  static_assert(ViewType::rank == 1 && !Is_Partitioned_Layout<ViewType>::value,
+                "remote_gather/remote_scatter require a rank-1 view with a "
+                "global layout");
+  static_assert(IndexView::rank == 1, "Indices must be a rank-1 view");
+#ifdef KRS_ENABLE_MPISPACE
+  if (Kokkos::Impl::mpi_window_is_fenced(view.impl_map().handle().loc))
+    Kokkos::Impl::throw_runtime_exception(
+        "remote_gather/remote_scatter are not supported on fenced MPISpace "
+        "allocations");
+#endif
+  // Owners and offsets are computed for the full view
+  (void)remote_spaces_index_block(view, caller);
+}
+
+}  // namespace Impl
+
+namespace RemoteSpaces {
+
+enum class ScatterOp { Replace, Add };
+
+/** \brief  Reads remote_src(indices(k)) into local_dst(k) for all k.
+ *
+ * Distinct indices are grouped by owning PE and every PE is read with a
+ * single indexed get, so a call costs O(#PEs) messages. Not collective;
+ * remote data must be up to date (RemoteSpace fence) before the call.
+ * Subviews are not supported.
+ */
+template <class LocalView, class RemoteView, class IndexView>
+void remote_gather(const LocalView &local_dst, const RemoteView &remote_src,
+                   const IndexView &indices) {
+  Impl::check_gather_scatter_args(remote_src, indices, "remote_gather");
+  using value_type = std::remove_const_t<typename RemoteView::value_type>;
+
+  const Impl::RemoteSpaces_IndexLists lists(remote_src, indices,
+                                            "remote_gather");
+  std::vector<value_type> packed(lists.size());
+  const auto &handle = remote_src.impl_map().handle();
+
+#ifdef KRS_ENABLE_MPISPACE
+  std::vector<MPI_Aint> displs(lists.size());
+  for (size_t j = 0; j < displs.size(); ++j)
+    displs[j] = sizeof(Kokkos::Impl::SharedAllocationHeader) +
+                (handle.loc.offset + lists.offsets[j]) * sizeof(value_type);
+  for (size_t pe = 0; pe < lists.counts.size(); ++pe) {
+    if (lists.counts[pe] == 0) continue;
+    Kokkos::Impl::mpi_indexed_get(packed.data() + lists.displs[pe],
+                                  displs.data() + lists.displs[pe],
+                                  lists.counts[pe], pe, handle.loc.win);
+  }
+  MPI_Win_flush_local_all(handle.loc.win);
+#else
+  for (size_t pe = 0; pe < lists.counts.size(); ++pe) {
+    if (lists.counts[pe] == 0) continue;
+    Kokkos::Impl::shmem_indexed_get(
+        packed.data() + lists.displs[pe], handle.ptr,
+        lists.offsets.data() + lists.displs[pe], lists.counts[pe], pe);
+  }
+  shmem_quiet();
+#endif
+
+  auto h_dst = Kokkos::create_mirror_view(local_dst);
+  for (size_t k = 0; k < lists.remap.extent(0); ++k)
+    h_dst(k) = packed[lists.remap(k)];
+  Kokkos::deep_copy(local_dst, h_dst);
+}
+
+/** \brief  Writes local_src(k) to remote_dst(indices(k)) for all k, or adds
+ * it with ScatterOp::Add.
+ *
+ * Distinct indices are grouped by owning PE, repeated ones combined
+ * locally, and every PE is updated with a single indexed accumulate (MPI)
+ * or a batch of non-blocking puts / atomic adds (SHMEM). Not collective;
+ * updates are visible after the next RemoteSpace fence. With
+ * ScatterOp::Replace the winner among repeated indices is unspecified.
+ * Subviews are not supported.
+ */
+template <class RemoteView, class LocalView, class IndexView>
+void remote_scatter(const RemoteView &remote_dst, const LocalView &local_src,
+                    const IndexView &indices,
+                    const ScatterOp op = ScatterOp::Replace) {
+  Impl::check_gather_scatter_args(remote_dst, indices, "remote_scatter");
+  using value_type = std::remove_const_t<typename RemoteView::value_type>;
+
+  const Impl::RemoteSpaces_IndexLists lists(remote_dst, indices,
+                                            "remote_scatter");
+  auto h_src =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), local_src);
+  // Repeated indices are combined into one update
+  std::vector<value_type> packed(lists.size(), value_type());
+  for (size_t k = 0; k < lists.remap.extent(0); ++k) {
+    if (op == ScatterOp::Add)
+      packed[lists.remap(k)] += h_src(k);
+    else
+      packed[lists.remap(k)] = h_src(k);
+  }
+  const auto &handle = remote_dst.impl_map().handle();
+
+#ifdef KRS_ENABLE_MPISPACE
+  std::vector<MPI_Aint> displs(lists.size());
+  for (size_t j = 0; j < displs.size(); ++j)
+    displs[j] = sizeof(Kokkos::Impl::SharedAllocationHeader) +
+                (handle.loc.offset + lists.offsets[j]) * sizeof(value_type);
+  const MPI_Op mpi_op = op == ScatterOp::Add ? MPI_SUM : MPI_REPLACE;
+  for (size_t pe = 0; pe < lists.counts.size(); ++pe) {
+    if (lists.counts[pe] == 0) continue;
+    Kokkos::Impl::mpi_indexed_accumulate(
+        packed.data() + lists.displs[pe], displs.data() + lists.displs[pe],
+        lists.counts[pe], pe, handle.loc.win, mpi_op);
+  }
+  MPI_Win_flush_local_all(handle.loc.win);
+#else
+  for (size_t pe = 0; pe < lists.counts.size(); ++pe) {
+    if (lists.counts[pe] == 0) continue;
+    const value_type *src  = packed.data() + lists.displs[pe];
+    const int64_t *offsets = lists.offsets.data() + lists.displs[pe];
+    if (op == ScatterOp::Add)
+      Kokkos::Impl::shmem_indexed_add(src, handle.ptr, offsets,
+                                      lists.counts[pe], pe);
+    else
+      Kokkos::Impl::shmem_indexed_put(src, handle.ptr, offsets,
+                                      lists.counts[pe], pe);
+  }
+  shmem_quiet();
+#endif
+}
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_GATHERSCATTER_HPP
@@ -0,0 +1,164 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_GHOSTEDVIEW_HPP
+#define KOKKOS_REMOTESPACES_GHOSTEDVIEW_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Global remote view whose dim0 partitions carry ghost planes.
+ *
+ * Every PE owns a block of dim0 planes of the logical global array, as for
+ * a global view, and allocates G ghost planes on either side of it. The
+ * partition is exposed as a local view: planes [0, G) mirror the last G
+ * planes of the previous PE, planes [G, G + block) are owned and planes
+ * [G + block, block + 2G) mirror the first G planes of the next PE.
+ * update_halos() refreshes the ghosts by replaying a CommPlan of one bulk
+ * get per neighbor, recorded at construction, so
+ * stencil kernels can read neighbors through view_local() without remote
+ * accesses. Boundaries are not periodic: the outer ghosts of the first and
+ * last PE are left untouched.
+ */
+template <class RemoteViewType>
+class GhostedView {
+ public:
+  using remote_view_type = RemoteViewType;
+  using data_type        = typename RemoteViewType::non_const_data_type;
+  using local_view_type =
+      Kokkos::View<data_type, Kokkos::LayoutRight,
+                   typename RemoteViewType::execution_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using range_type = Kokkos::pair<size_t, size_t>;
+
+  static_assert(Is_View_Of_Type_RemoteSpaces<RemoteViewType>::value,
+                "GhostedView requires a remote view");
+  static_assert(RemoteViewType::rank > 0,
+                "GhostedView requires a view of rank > 0");
+  static_assert(std::is_same<typename RemoteViewType::array_layout,
+                             Kokkos::LayoutRight>::value,
+                "GhostedView requires a LayoutRight global view, ghost "
+                "planes must be contiguous");
+
+  GhostedView() = default;
+
+  /** \brief  Allocates the view with global dim0 extent n0 and the given
+   * remaining extents, plus ghosts planes on either side of every
+   * partition */
+  template <class... Args>
+  GhostedView(const std::string &label, const size_t ghosts, const size_t n0,
+              Args... extents)
+      : m_ghosts(ghosts),
+        m_n0(n0),
+        m_block(get_indexing_block_size(n0)),
+        m_remote(label, get_num_pes() * (m_block + 2 * ghosts), extents...),
+        m_local(alias_local(
+            m_remote, std::make_index_sequence<RemoteViewType::rank>())),
+        m_halos(std::make_shared<CommPlan>()) {
+    if (m_block < m_ghosts && get_num_pes() > 1)
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::RemoteSpaces::GhostedView: more ghost "
+          "planes than planes per PE");
+    record_halos();
+  }
+
+  /** \brief  Underlying remote view, ghost planes included */
+  remote_view_type view_remote() const { return m_remote; }
+
+  /** \brief  Local partition with ghosts, indexed with local dim0 indices */
+  local_view_type view_local() const { return m_local; }
+
+  size_t ghosts() const { return m_ghosts; }
+
+  /** \brief  Local dim0 indices of the owned planes, excluding padding */
+  range_type owned() const {
+    const size_t first = get_my_pe() * m_block;
+    const size_t n     = first < m_n0 ? std::min(m_block, m_n0 - first) : 0;
+    return range_type(m_ghosts, m_ghosts + n);
+  }
+
+  /** \brief  Global dim0 index of the first owned plane */
+  size_t global_begin() const { return get_my_pe() * m_block; }
+
+  /** \brief  Fills the ghost planes from the neighboring PEs.
+   *
+   * Collective: waits for all PEs to finish writing their owned planes and,
+   * before returning, for all neighbors to finish reading them.
+   */
+  void update_halos() const {
+    Kokkos::fence();
+    RemoteViewType::memory_space::fence();
+    if (m_halos) m_halos->execute();
+    // Owned planes must not change while a neighbor still reads them
+    RemoteViewType::memory_space::fence();
+  }
+
+ private:
+  void record_halos() {
+    const int my_pe   = get_my_pe();
+    const int num_pes = get_num_pes();
+    const size_t part = m_block + 2 * m_ghosts;
+    if (m_ghosts == 0) return;
+    if (my_pe > 0) {
+      // Last owned planes of the previous PE
+      const size_t src = (my_pe - 1) * part + m_block;
+      m_halos->record_get(local_planes(0, m_ghosts),
+                          remote_planes(src, src + m_ghosts));
+    }
+    if (my_pe + 1 < num_pes && (my_pe + 1) * m_block < m_n0) {
+      // First owned planes of the next PE
+      const size_t src = (my_pe + 1) * part + m_ghosts;
+      m_halos->record_get(local_planes(m_ghosts + m_block, part),
+                          remote_planes(src, src + m_ghosts));
+    }
+  }
+
+  auto local_planes(const size_t first, const size_t last) const {
+    return Kokkos::Impl::get_local_subview(m_local, range_type(first, last));
+  }
+
+  auto remote_planes(const size_t first, const size_t last) const {
+    return Kokkos::Impl::get_local_subview(m_remote, range_type(first, last));
+  }
+
+  template <size_t... Rs>
+  static local_view_type alias_local(const RemoteViewType &view,
+                                     std::index_sequence<Rs...>) {
+    return local_view_type(view.data(), view.extent(Rs)...);
+  }
+
+  size_t m_ghosts = 0;
+  size_t m_n0     = 0;
+  size_t m_block  = 0;
+  remote_view_type m_remote;
+  local_view_type m_local;
+  // Shared by all copies, as the views are
+  std::shared_ptr<CommPlan> m_halos;
+};
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_GHOSTEDVIEW_HPP
@@ -67,6 +67,46 @@ struct Is_View_Of_Type_RemoteSpaces {
 
 namespace Impl {
 
+/* Process-wide PE topology. Host backends query the runtime once, when
+ * the memory space is first constructed, and read the cached values
+ * afterwards. The function-local static makes a first query from a
+ * parallel kernel thread-safe. NVSHMEM and ROCSHMEM keep their own
+ * device-side copy and are queried directly. */
+struct RemoteSpaces_Topology {
+  int num_PEs = 0;
+  int my_PE   = 0;
+};
+
+inline const RemoteSpaces_Topology &remote_spaces_topology() {
+  static const RemoteSpaces_Topology topology{
+      static_cast<int>(Kokkos::Experimental::get_num_pes()),
+      static_cast<int>(Kokkos::Experimental::get_my_pe())};
+  return topology;
+}
+
+inline void initialize_topology() { (void)remote_spaces_topology(); }
+
+/* Number of PEs. Folds to a constant if KRS_NUM_PES is set. */
+KOKKOS_INLINE_FUNCTION int get_num_pes_impl() {
+  if constexpr (RemoteSpaces_StaticNumPEs > 0) {
+    return RemoteSpaces_StaticNumPEs;
+  } else {
+#if defined(KRS_ENABLE_NVSHMEMSPACE) || defined(KRS_ENABLE_ROCSHMEMSPACE)
+    return Kokkos::Experimental::get_num_pes();
+#else
+    return remote_spaces_topology().num_PEs;
+#endif
+  }
+}
+
+KOKKOS_INLINE_FUNCTION int get_my_pe_impl() {
+#if defined(KRS_ENABLE_NVSHMEMSPACE) || defined(KRS_ENABLE_ROCSHMEMSPACE)
+  return Kokkos::Experimental::get_my_pe();
+#else
+  return remote_spaces_topology().my_PE;
+#endif
+}
+
 template <class view_type>
 bool is_local_view(
     view_type v,
@@ -107,37 +147,24 @@ struct RemoteSpaces_View_Properties {
     total_offset         = 0;
     R0_offset            = 0;
     R0_size              = 0;
-    num_PEs              = Kokkos::Experimental::get_num_pes();
-    my_PE                = Kokkos::Experimental::get_my_pe();
-  }
-
-  KOKKOS_FUNCTION
-  RemoteSpaces_View_Properties(const RemoteSpaces_View_Properties &rhs) {
-    using_local_indexing = rhs.using_local_indexing;
-    total_offset         = rhs.total_offset;
-    R0_offset            = rhs.R0_offset;
-    R0_size              = rhs.R0_size;
-    num_PEs              = rhs.num_PEs;
-    my_PE                = rhs.my_PE;
+    num_PEs              = get_num_pes_impl();
+    my_PE                = get_my_pe_impl();
   }
 
-  KOKKOS_FUNCTION RemoteSpaces_View_Properties &operator=(
-      const RemoteSpaces_View_Properties &rhs) {
-    using_local_indexing = rhs.using_local_indexing;
-    total_offset         = rhs.total_offset;
-    R0_offset            = rhs.R0_offset;
-    R0_size              = rhs.R0_size;
-    num_PEs              = rhs.num_PEs;
-    my_PE                = rhs.my_PE;
-    return *this;
-  }
+  RemoteSpaces_View_Properties(const RemoteSpaces_View_Properties &) = default;
+  RemoteSpaces_View_Properties &operator=(
+      const RemoteSpaces_View_Properties &) = default;
 };
 
+static_assert(
+    std::is_trivially_copyable<RemoteSpaces_View_Properties<size_t>>::value,
+    "View properties are copied into every mapping and subview");
+
 }  // namespace Impl
 
 template <typename T>
 KOKKOS_INLINE_FUNCTION auto get_indexing_block_size(T size) {
-  auto num_pes = Kokkos::Experimental::get_num_pes();
+  auto num_pes = Impl::get_num_pes_impl();
   auto block   = (size + static_cast<T>(num_pes) - 1) / num_pes;
   return block;
 }
@@ -148,7 +175,7 @@ KOKKOS_INLINE_FUNCTION Kokkos::pair<T, T> getRange(T size, int pe) {
   auto start = static_cast<T>(pe) * block;
   auto end   = (static_cast<T>(pe) + 1) * block;
 
-  auto num_pes = Kokkos::Experimental::get_num_pes();
+  auto num_pes = Impl::get_num_pes_impl();
   if (size < num_pes) {
     T diff = (num_pes * block) - size;
     if (pe > num_pes - 1 - diff) end--;
@@ -168,7 +195,7 @@ KOKKOS_INLINE_FUNCTION Kokkos::pair<T, T> get_range(T size, int pe) {
 
 template <typename T>
 KOKKOS_INLINE_FUNCTION Kokkos::pair<T, T> get_local_range(T size) {
-  auto pe = get_my_pe();
+  auto pe = Impl::get_my_pe_impl();
   return getRange(size, pe);
 }
 
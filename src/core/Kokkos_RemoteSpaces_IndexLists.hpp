@@ -0,0 +1,134 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_INDEXLISTS_HPP
+#define KOKKOS_REMOTESPACES_INDEXLISTS_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <mpi.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+/* Elements per PE of a rank-1 remote view with a global layout, for
+ * operations on lists of its global indices. Subviews are rejected, as
+ * are views mapped to a single PE while several PEs run. */
+template <class ViewType>
+int64_t remote_spaces_index_block(const ViewType &view, const char *caller) {
+  const auto &map = view.impl_map();
+  const std::string prefix =
+      std::string("Kokkos::Experimental::RemoteSpaces::") + caller;
+  if (map.remote_view_props.using_local_indexing ||
+      map.remote_view_props.R0_offset != 0)
+    Kokkos::Impl::throw_runtime_exception(prefix +
+                                          ": subviews are not supported");
+  if (!map.is_single_PE()) return map.get_R0_size();
+  if (get_num_pes_impl() > 1)
+    Kokkos::Impl::throw_runtime_exception(
+        prefix + ": views mapped to a single PE are not supported");
+  return view.extent(0);
+}
+
+/* Distinct global indices of a rank-1 remote view with a global layout,
+ * sorted and thereby grouped by owning PE. Entries [displs[pe],
+ * displs[pe] + counts[pe]) are owned by pe, entry u being element
+ * offsets[u] there. Index k of the original list is entry remap(k). */
+struct RemoteSpaces_IndexLists {
+  using remap_type = Kokkos::View<size_t *, Kokkos::HostSpace>;
+
+  std::vector<int> counts;
+  std::vector<int> displs;
+  std::vector<int64_t> offsets;
+  remap_type remap;
+
+  template <class ViewType, class IndexView>
+  RemoteSpaces_IndexLists(const ViewType &view, const IndexView &indices,
+                          const char *caller) {
+    const int num_pes   = int(get_num_pes_impl());
+    const int64_t block = remote_spaces_index_block(view, caller);
+
+    auto h_indices =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), indices);
+    const size_t n = h_indices.extent(0);
+
+    std::vector<int64_t> unique(n);
+    for (size_t k = 0; k < n; ++k) unique[k] = int64_t(h_indices(k));
+    std::sort(unique.begin(), unique.end());
+    unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+
+    remap = remap_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "IndexListsRemap"), n);
+    for (size_t k = 0; k < n; ++k)
+      remap(k) = std::lower_bound(unique.begin(), unique.end(),
+                                  int64_t(h_indices(k))) -
+                 unique.begin();
+
+    counts.assign(num_pes, 0);
+    displs.assign(num_pes, 0);
+    offsets.resize(unique.size());
+    for (size_t u = 0; u < unique.size(); ++u) {
+      counts[unique[u] / block]++;
+      offsets[u] = unique[u] % block;
+    }
+    for (int pe = 1; pe < num_pes; ++pe)
+      displs[pe] = displs[pe - 1] + counts[pe - 1];
+  }
+
+  /* Number of distinct indices */
+  size_t size() const { return offsets.size(); }
+
+  /* Exchanges the lists with all PEs. peer_offsets receives the offsets
+   * of this PE listed by every PE, peer_counts[pe] of them from pe at
+   * peer_displs[pe]. Collective. */
+  void exchange(std::vector<int> &peer_counts, std::vector<int> &peer_displs,
+                std::vector<int64_t> &peer_offsets) const {
+    const int num_pes = int(counts.size());
+    peer_counts.resize(num_pes);
+    MPI_Alltoall(counts.data(), 1, MPI_INT, peer_counts.data(), 1, MPI_INT,
+                 MPI_COMM_WORLD);
+
+    peer_displs.assign(num_pes, 0);
+    for (int pe = 1; pe < num_pes; ++pe)
+      peer_displs[pe] = peer_displs[pe - 1] + peer_counts[pe - 1];
+    peer_offsets.resize(peer_displs[num_pes - 1] + peer_counts[num_pes - 1]);
+    MPI_Alltoallv(offsets.data(), counts.data(), displs.data(), MPI_INT64_T,
+                  peer_offsets.data(), peer_counts.data(), peer_displs.data(),
+                  MPI_INT64_T, MPI_COMM_WORLD);
+  }
+};
+
+/* Element counts or displacements in bytes, for exchanges moving elements
+ * as bytes */
+inline std::vector<int> remote_spaces_to_bytes(const std::vector<int> &elems,
+                                               const int elem_bytes) {
+  std::vector<int> bytes(elems.size());
+  for (size_t pe = 0; pe < elems.size(); ++pe)
+    bytes[pe] = elems[pe] * elem_bytes;
+  return bytes;
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_INDEXLISTS_HPP
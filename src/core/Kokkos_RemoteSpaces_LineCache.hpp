@@ -0,0 +1,146 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_LINECACHE_HPP
+#define KOKKOS_REMOTESPACES_LINECACHE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+/* Identifies one cache line of a segment (allocation) on a PE */
+struct RemoteSpaces_LineKey {
+  int pe;
+  int64_t segment;
+  uint64_t line;
+
+  bool operator==(const RemoteSpaces_LineKey &rhs) const {
+    return pe == rhs.pe && segment == rhs.segment && line == rhs.line;
+  }
+};
+
+/* Direct-mapped software cache of remote lines, shared by the threads of a
+ * PE.
+ *
+ * Every slot is guarded by a sequence counter. An odd counter marks a slot
+ * that has been claimed and is waiting for its line; readers copy the data
+ * and re-check the counter (seqlock) so that concurrent evictions are
+ * detected. Lines are tagged with the epoch they were requested in, so
+ * invalidation (at fence) only bumps the epoch. */
+class RemoteSpaces_LineCache {
+ public:
+  enum class Lookup { Hit, Miss, Busy };
+
+  RemoteSpaces_LineCache(size_t num_lines, size_t line_bytes)
+      : m_num_lines(num_lines),
+        m_line_bytes(line_bytes),
+        m_slots(new Slot[num_lines]),
+        m_data(new char[num_lines * line_bytes]),
+        m_epoch(1) {}
+
+  size_t line_bytes() const { return m_line_bytes; }
+
+  size_t slot_of(const RemoteSpaces_LineKey &key) const {
+    uint64_t h = key.line * 0x9E3779B97F4A7C15ull;
+    h ^= (uint64_t(key.segment) << 32) ^ uint64_t(key.pe);
+    h ^= h >> 29;
+    return h % m_num_lines;
+  }
+
+  /* Copies nbytes at offset of the line into dst if the line is cached */
+  Lookup read(const RemoteSpaces_LineKey &key, size_t offset, size_t nbytes,
+              void *dst) const {
+    const size_t slot_id = slot_of(key);
+    const Slot &slot     = m_slots[slot_id];
+    const char *line     = m_data.get() + slot_id * m_line_bytes;
+    for (;;) {
+      uint64_t seq = slot.seq.load(std::memory_order_acquire);
+      if (seq & 1) return Lookup::Busy;
+      if (!(slot.key == key) ||
+          slot.epoch != m_epoch.load(std::memory_order_relaxed))
+        return Lookup::Miss;
+      std::memcpy(dst, line + offset, nbytes);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) == seq) return Lookup::Hit;
+    }
+  }
+
+  /* Claims the slot of key for a new line. Returns false if the slot is
+   * being filled by another request. */
+  bool claim(const RemoteSpaces_LineKey &key, size_t &slot_id) {
+    slot_id      = slot_of(key);
+    Slot &slot   = m_slots[slot_id];
+    uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+    if (seq & 1) return false;
+    if (!slot.seq.compare_exchange_strong(seq, seq + 1,
+                                          std::memory_order_acquire))
+      return false;
+    slot.key   = key;
+    slot.epoch = m_epoch.load(std::memory_order_relaxed);
+    return true;
+  }
+
+  /* Publishes the line of a claimed slot */
+  void fill(size_t slot_id, const char *line) {
+    Slot &slot = m_slots[slot_id];
+    std::memcpy(m_data.get() + slot_id * m_line_bytes, line, m_line_bytes);
+    slot.seq.fetch_add(1, std::memory_order_release);
+  }
+
+  /* Copies nbytes at offset of the line into dst. On a miss the line is
+   * read with fetch(buffer) and published; lines claimed by another thread
+   * are fetched without being cached. */
+  template <class Fetch>
+  void get(const RemoteSpaces_LineKey &key, size_t offset, size_t nbytes,
+           void *dst, Fetch &&fetch) {
+    if (read(key, offset, nbytes, dst) == Lookup::Hit) return;
+    thread_local std::vector<char> line;
+    line.resize(m_line_bytes);
+    fetch(line.data());
+    size_t slot_id;
+    if (claim(key, slot_id)) fill(slot_id, line.data());
+    std::memcpy(dst, line.data() + offset, nbytes);
+  }
+
+  void invalidate() { m_epoch.fetch_add(1, std::memory_order_relaxed); }
+
+ private:
+  struct Slot {
+    std::atomic<uint64_t> seq{0};
+    RemoteSpaces_LineKey key{-1, -1, 0};
+    uint64_t epoch = 0;
+  };
+
+  size_t m_num_lines;
+  size_t m_line_bytes;
+  std::unique_ptr<Slot[]> m_slots;
+  std::unique_ptr<char[]> m_data;
+  std::atomic<uint64_t> m_epoch;
+};
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_LINECACHE_HPP
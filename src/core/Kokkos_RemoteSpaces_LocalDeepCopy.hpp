@@ -21,6 +21,11 @@
 
 #include <Kokkos_RemoteSpaces.hpp>
 
+/* Size of the buffer staging copies between two remote views */
+#ifndef KRS_LOCAL_DEEP_COPY_STAGING_BYTES
+#define KRS_LOCAL_DEEP_COPY_STAGING_BYTES 4096
+#endif
+
 namespace Kokkos {
 namespace Impl {
 
@@ -33,30 +38,22 @@ auto KOKKOS_INLINE_FUNCTION get_local_subview(T view, P r) {
   } else if constexpr (T::traits::dimension::rank == 2) {
     return Kokkos::subview(view, r, Kokkos::ALL);
   } else if constexpr (T::traits::dimension::rank == 3) {
-    /*Not supported, FIXME*/
-    static_assert("Unsupported view type");
     return Kokkos::subview(view, r, Kokkos::ALL, Kokkos::ALL);
   } else if constexpr (T::traits::dimension::rank == 4) {
-    /*Not supported, FIXME*/
-    static_assert("Unsupported view type");
     return Kokkos::subview(view, r, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
   } else if constexpr (T::traits::dimension::rank == 5) {
-    /*Not supported, FIXME*/
-    static_assert("Unsupported view type");
     return Kokkos::subview(view, r, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                            Kokkos::ALL);
   } else if constexpr (T::traits::dimension::rank == 6) {
-    /*Not supported, FIXME*/
-    static_assert("Unsupported view type");
     return Kokkos::subview(view, r, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                            Kokkos::ALL, Kokkos::ALL);
   } else if constexpr (T::traits::dimension::rank == 7) {
-    /*Not supported, FIXME*/
-    static_assert("Unsupported view type");
     return Kokkos::subview(view, r, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
                            Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
   } else {
-    static_assert("Unsupported view type");
+    static_assert(T::traits::dimension::rank == 8, "Unsupported view type");
+    return Kokkos::subview(view, r, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
+                           Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
   }
 }
 
@@ -64,6 +61,189 @@ template <class T>
 auto KOKKOS_INLINE_FUNCTION get_view_adr(T view) {
   return view.impl_map().get_ptr();
 }
+
+/* Placement of the dim0 rows of a remote view. A dim0 subview of a global
+ * layout whose range crosses a partition boundary is split into per-PE
+ * segments of rows; any other view lives on its logical PE. */
+template <class ViewType>
+struct RemoteSpaces_Dim0Placement {
+  static constexpr bool is_row_contiguous =
+      ViewType::rank == 1 ||
+      Kokkos::Experimental::Is_Partitioned_Layout<ViewType>::value ||
+      std::is_same<typename ViewType::array_layout, Kokkos::LayoutRight>::value;
+
+  int pe;
+  size_t first;
+  size_t block;
+  size_t row_elems;
+  bool split;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit RemoteSpaces_Dim0Placement(const ViewType &view) {
+    const auto &map   = view.impl_map();
+    const auto &props = map.remote_view_props;
+    const size_t n    = view.extent(0);
+    pe                = map.get_logical_PE();
+    first             = props.R0_offset;
+    row_elems         = ViewType::rank == 1 ? 1 : map.stride_0();
+    if constexpr (Kokkos::Experimental::Is_Partitioned_Layout<ViewType>::value)
+      block = 0;
+    else
+      block = map.is_single_PE() ? 0 : map.get_R0_size();
+    split = props.using_local_indexing && block > 0 && n > 0 &&
+            first / block != (first + n - 1) / block;
+  }
+
+  // PE holding row i
+  KOKKOS_INLINE_FUNCTION int pe_of(size_t i) const {
+    return split ? int((first + i) / block) : pe;
+  }
+
+  // Element offset of row i from the view's data handle on that PE
+  KOKKOS_INLINE_FUNCTION size_t offset_of(size_t i) const {
+    return (split ? (first + i) % block : i) * row_elems;
+  }
+
+  // Rows from i up to the next partition boundary
+  KOKKOS_INLINE_FUNCTION size_t rows_on_pe(size_t i) const {
+    return split ? block - (first + i) % block : ~size_t(0);
+  }
+};
+
+/* Copies n elements between two locations of which either may be remote.
+ * Offsets are relative to the views' data handles. Remote-to-remote copies
+ * are staged through a local buffer of staging_elems elements. */
+template <class DstView, class SrcView>
+KOKKOS_INLINE_FUNCTION void local_deep_copy_block(
+    const DstView &dst, const int dst_pe, const size_t dst_offset,
+    const SrcView &src, const int src_pe, const size_t src_offset,
+    const size_t n, typename DstView::non_const_value_type *staging,
+    const size_t staging_elems) {
+  using value_type  = typename DstView::non_const_value_type;
+  using dst_block_t = BlockDataHandle<value_type, typename DstView::traits>;
+  using src_block_t = BlockDataHandle<value_type, typename SrcView::traits>;
+
+  const int my_pe     = src.impl_map().get_PE();
+  value_type *dst_ptr = dst.impl_map().handle().ptr + dst_offset;
+  value_type *src_ptr =
+      const_cast<value_type *>(src.impl_map().handle().ptr) + src_offset;
+
+  auto get = [&](value_type *local, const size_t i, const size_t m) {
+#ifdef KRS_ENABLE_MPISPACE
+    const auto &loc = src.impl_map().handle().loc;
+    src_block_t(local, loc, loc.offset + src_offset + i, m, src_pe).get();
+#else
+    src_block_t(local, src_ptr + i, m, src_pe).get();
+#endif
+  };
+
+  auto put = [&](value_type *local, const size_t i, const size_t m) {
+#ifdef KRS_ENABLE_MPISPACE
+    const auto &loc = dst.impl_map().handle().loc;
+    dst_block_t(local, loc, loc.offset + dst_offset + i, m, dst_pe).put();
+#else
+    dst_block_t(dst_ptr + i, local, m, dst_pe).put();
+#endif
+  };
+
+  if (src_pe == my_pe && dst_pe == my_pe) {
+    for (size_t i = 0; i < n; ++i) dst_ptr[i] = src_ptr[i];
+  } else if (dst_pe == my_pe) {
+    get(dst_ptr, 0, n);
+  } else if (src_pe == my_pe) {
+    put(src_ptr, 0, n);
+  } else {
+#ifdef KRS_ENABLE_MPISPACE
+    // Staged gets on fenced windows only complete at MPISpace::fence
+    if (mpi_window_is_fenced(src.impl_map().handle().loc))
+      Kokkos::abort(
+          "local_deep_copy between two remote PEs is not supported on fenced "
+          "MPISpace allocations.");
+#endif
+    for (size_t i = 0; i < n; i += staging_elems) {
+      const size_t m = n - i < staging_elems ? n - i : staging_elems;
+      get(staging, i, m);
+      put(staging, i, m);
+    }
+  }
+}
+
+/* Copies dim0 rows [begin, end) of src to dst with one block transfer per
+ * run of rows that stays on a single source and destination PE. Rows of
+ * LayoutLeft views are strided and are copied as one block per column. */
+template <class DstView, class SrcView>
+KOKKOS_INLINE_FUNCTION void local_deep_copy_segmented(
+    const DstView &dst, const SrcView &src, const size_t begin,
+    const size_t end, typename DstView::non_const_value_type *staging,
+    const size_t staging_elems) {
+  using dst_placement_t = RemoteSpaces_Dim0Placement<DstView>;
+  using src_placement_t = RemoteSpaces_Dim0Placement<SrcView>;
+
+  const dst_placement_t dst_rows(dst);
+  const src_placement_t src_rows(src);
+  const size_t n0 = dst.extent(0);
+
+  if (!dst_rows.split && !src_rows.split && begin == 0 && end == n0) {
+    // Each view is a single block on one PE
+    local_deep_copy_block(dst, dst_rows.pe, 0, src, src_rows.pe, 0, src.span(),
+                          staging, staging_elems);
+  } else if (dst_placement_t::is_row_contiguous &&
+             src_placement_t::is_row_contiguous) {
+    for (size_t i = begin; i < end;) {
+      size_t n = end - i;
+      n        = dst_rows.rows_on_pe(i) < n ? dst_rows.rows_on_pe(i) : n;
+      n        = src_rows.rows_on_pe(i) < n ? src_rows.rows_on_pe(i) : n;
+      local_deep_copy_block(dst, dst_rows.pe_of(i), dst_rows.offset_of(i), src,
+                            src_rows.pe_of(i), src_rows.offset_of(i),
+                            n * src_rows.row_elems, staging, staging_elems);
+      i += n;
+    }
+  } else if (dst_rows.split || src_rows.split) {
+    Kokkos::abort(
+        "local_deep_copy: views spanning multiple PEs require contiguous "
+        "dim0 rows");
+  } else if (std::is_same<typename DstView::array_layout,
+                          Kokkos::LayoutLeft>::value &&
+             std::is_same<typename SrcView::array_layout,
+                          Kokkos::LayoutLeft>::value) {
+    const size_t columns = n0 > 0 ? src.span() / n0 : 0;
+    for (size_t c = 0; c < columns; ++c)
+      local_deep_copy_block(dst, dst_rows.pe, c * n0 + begin, src, src_rows.pe,
+                            c * n0 + begin, end - begin, staging,
+                            staging_elems);
+  } else if (begin == 0) {
+    // No dim0 slabs for other layouts, the first slab copies the span
+    local_deep_copy_block(dst, dst_rows.pe, 0, src, src_rows.pe, 0, src.span(),
+                          staging, staging_elems);
+  }
+#ifdef KRS_ENABLE_MPISPACE
+  const auto &loc = dst.impl_map().handle().loc;
+  if (!mpi_window_is_fenced(loc)) MPI_Win_flush_all(loc.win);
+#endif
+#ifdef KRS_ENABLE_NVSHMEMSPACE
+  nvshmem_quiet();
+#endif
+}
+
+/* Number of elements of a KRS_LOCAL_DEEP_COPY_STAGING_BYTES staging buffer */
+template <class T>
+constexpr size_t local_deep_copy_staging_elems =
+    KRS_LOCAL_DEEP_COPY_STAGING_BYTES / sizeof(T) > 0
+        ? KRS_LOCAL_DEEP_COPY_STAGING_BYTES / sizeof(T)
+        : 1;
+
+/* Copies dim0 rows [begin, end) of src to dst, staging remote-to-remote
+ * segments through a stack buffer */
+template <class DstView, class SrcView>
+KOKKOS_INLINE_FUNCTION void local_deep_copy_segmented(const DstView &dst,
+                                                      const SrcView &src,
+                                                      const size_t begin,
+                                                      const size_t end) {
+  using value_type               = typename DstView::non_const_value_type;
+  constexpr size_t staging_elems = local_deep_copy_staging_elems<value_type>;
+  value_type staging[staging_elems];
+  local_deep_copy_segmented(dst, src, begin, end, staging, staging_elems);
+}
 }  // namespace Impl
 
 namespace Experimental {
@@ -82,31 +262,25 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy_contiguous(
          std::is_same<typename ViewTraits<ST, SP...>::specialize,
                       Kokkos::Experimental::RemoteSpaceSpecializeTag>::value)>::
         type * = nullptr) {
+  using dst_placement_t =
+      Kokkos::Impl::RemoteSpaces_Dim0Placement<View<DT, DP...>>;
+  using src_placement_t =
+      Kokkos::Impl::RemoteSpaces_Dim0Placement<View<ST, SP...>>;
+  using value_type = typename ViewTraits<DT, DP...>::non_const_value_type;
+  using size_type  = typename ViewTraits<DT, DP...>::size_type;
+
   int src_rank = src.impl_map().get_logical_PE();
   int dst_rank = dst.impl_map().get_logical_PE();
-  int my_rank  = get_my_pe();
-
-  if (src_rank != my_rank && dst_rank != my_rank) {
-    // Both views are remote, copy through view accessor (TODO)
-    static_assert("local_deep_copy for provided views is not supported");
-  }
+  int my_rank  = src.impl_map().get_PE();
+  bool split   = dst_placement_t(dst).split || src_placement_t(src).split;
 
-  if (dst_rank == my_rank && src_rank == my_rank) {
+  if (dst_rank == my_rank && src_rank == my_rank && !split) {
     // Both views are local, copy as array operation
     Kokkos::parallel_for(Kokkos::TeamThreadRange(team, src.span()),
                          [&](const int &i) { dst.data()[i] = src.data()[i]; });
     return;
   }
 
-  using src_data_block_t =
-      Kokkos::Impl::BlockDataHandle<typename ViewTraits<ST, SP...>::value_type,
-                                    ViewTraits<ST, SP...>>;
-  using dst_data_block_t =
-      Kokkos::Impl::BlockDataHandle<typename ViewTraits<DT, DP...>::value_type,
-                                    ViewTraits<DT, DP...>>;
-
-  using size_type = typename ViewTraits<DT, DP...>::size_type;
-
   auto league_size = team.league_size();
   auto team_ID     = team.league_rank();
 
@@ -119,55 +293,21 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy_contiguous(
   auto team_range = Kokkos::pair(size_type(start_offset),
                                  size_type(start_offset + team_block));
 
-  // Construct per-team subviews
-  auto src_subview = Kokkos::Impl::get_local_subview(src, team_range);
-  auto dst_subview = Kokkos::Impl::get_local_subview(dst, team_range);
-
-  // Construct subview offsets
-  auto src_subview_ptr = Kokkos::Impl::get_view_adr(src_subview);
-  auto dst_subview_ptr = Kokkos::Impl::get_view_adr(dst_subview);
-
-  if (src_rank != my_rank) {
-    Kokkos::single(Kokkos::PerTeam(team), [&]() {
-#ifdef KRS_ENABLE_MPISPACE
-      src_data_block_t data_block = src_data_block_t(
-          dst_subview_ptr, src_subview.impl_map().handle().loc.win,
-          src_subview.impl_map().handle().loc.offset, src_subview.span(),
-          src_rank);
-#else
-      src_data_block_t data_block =
-          src_data_block_t(dst_subview_ptr, src_subview_ptr, src_subview.span(), src_rank);
-#endif
-      data_block.get();
-#ifdef KRS_ENABLE_MPISPACE
-      MPI_Win_flush_all(src.impl_map().m_handle.loc.win);
-#endif
-#ifdef KRS_ENABLE_NVSHMEMSPACE
-      nvshmem_quiet();
-#endif
-    });
-  } else if (dst_rank != my_rank) {
-    Kokkos::single(Kokkos::PerTeam(team), [&]() {
-#ifdef KRS_ENABLE_MPISPACE
-      dst_data_block_t data_block = dst_data_block_t(
-          src_subview_ptr, dst_subview.impl_map().handle().loc.win,
-          dst_subview.impl_map().handle().loc.offset, dst_subview.span(),
-          dst_rank);
-#else
-      src_data_block_t data_block =
-          src_data_block_t(dst_subview_ptr, src_subview_ptr, src_subview.span(), dst_rank);
-#endif
-      data_block.put();
-#ifdef KRS_ENABLE_MPISPACE
-      MPI_Win_flush_all(src.impl_map().m_handle.loc.win);
-#endif
-#ifdef KRS_ENABLE_NVSHMEMSPACE
-      nvshmem_quiet();
-#endif
-    });
-  } else {
-    static_assert("Unable to determine view data location");
-  }
+  // Copy the team's dim0 slab in per-PE segments, staging remote-to-remote
+  // segments through team scratch if available and the stack otherwise
+  Kokkos::single(Kokkos::PerTeam(team), [&]() {
+    constexpr size_t staging_elems =
+        Kokkos::Impl::local_deep_copy_staging_elems<value_type>;
+    value_type *staging = static_cast<value_type *>(
+        team.team_scratch(0).get_shmem(staging_elems * sizeof(value_type)));
+    if (staging)
+      Kokkos::Impl::local_deep_copy_segmented(dst, src, team_range.first,
+                                              team_range.second, staging,
+                                              staging_elems);
+    else
+      Kokkos::Impl::local_deep_copy_segmented(dst, src, team_range.first,
+                                              team_range.second);
+  });
 }
 
 template <class DT, class... DP, class ST, class... SP>
@@ -179,67 +319,24 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy_contiguous(
          std::is_same<typename ViewTraits<ST, SP...>::specialize,
                       Kokkos::Experimental::RemoteSpaceSpecializeTag>::value)>::
         type * = nullptr) {
+  using dst_placement_t =
+      Kokkos::Impl::RemoteSpaces_Dim0Placement<View<DT, DP...>>;
+  using src_placement_t =
+      Kokkos::Impl::RemoteSpaces_Dim0Placement<View<ST, SP...>>;
+
   int src_rank = src.impl_map().get_logical_PE();
   int dst_rank = dst.impl_map().get_logical_PE();
-  int my_rank  = get_my_pe();
+  int my_rank  = src.impl_map().get_PE();
+  bool split   = dst_placement_t(dst).split || src_placement_t(src).split;
 
-  if (src_rank != my_rank && dst_rank != my_rank) {
-    // Both views are remote, copy through view accessor (TODO)
-    static_assert("local_deep_copy for provided views is not supported");
-  }
-
-  if (dst_rank == my_rank && src_rank == my_rank) {
+  if (dst_rank == my_rank && src_rank == my_rank && !split) {
     // Both views are local, copy as array operation
     for (size_t i = 0; i < src.span(); ++i) dst.data()[i] = src.data()[i];
     return;
   }
 
-  using src_data_block_t =
-      Kokkos::Impl::BlockDataHandle<typename ViewTraits<ST, SP...>::value_type,
-                                    ViewTraits<ST, SP...>>;
-  using dst_data_block_t =
-      Kokkos::Impl::BlockDataHandle<typename ViewTraits<DT, DP...>::value_type,
-                                    ViewTraits<DT, DP...>>;
-
-  // Construct subview offsets
-  auto src_subview_ptr = Kokkos::Impl::get_view_adr(src);
-  auto dst_subview_ptr = Kokkos::Impl::get_view_adr(dst);
-
-  if (src_rank != my_rank) {
-#ifdef KRS_ENABLE_MPISPACE
-    src_data_block_t data_block = src_data_block_t(
-        dst_subview_ptr, src.impl_map().handle().loc.win,
-        src.impl_map().handle().loc.offset, src.span(), src_rank);
-#else
-    src_data_block_t data_block = src_data_block_t(
-        dst_subview_ptr, src_subview_ptr, src.span(), src_rank);
-#endif
-    data_block.get();
-#ifdef KRS_ENABLE_MPISPACE
-    MPI_Win_flush_all(src.impl_map().m_handle.loc.win);
-#endif
-#ifdef KRS_ENABLE_NVSHMEMSPACE
-    nvshmem_quiet();
-#endif
-  } else if (dst_rank != my_rank) {
-#ifdef KRS_ENABLE_MPISPACE
-    dst_data_block_t data_block = dst_data_block_t(
-        src_subview_ptr, dst.impl_map().handle().loc.win,
-        dst.impl_map().handle().loc.offset, dst.span(), dst_rank);
-#else
-    src_data_block_t data_block = src_data_block_t(
-        dst_subview_ptr, src_subview_ptr, src.span(), dst_rank);
-#endif
-    data_block.put();
-#ifdef KRS_ENABLE_MPISPACE
-    MPI_Win_flush_all(src.impl_map().m_handle.loc.win);
-#endif
-#ifdef KRS_ENABLE_NVSHMEMSPACE
-    nvshmem_quiet();
-#endif
-  } else {
-    static_assert("Unable to determine view data location");
-  }
+  // Copy in per-PE segments, staging remote-to-remote segments locally
+  Kokkos::Impl::local_deep_copy_segmented(dst, src, 0, dst.extent(0));
 }
 
 template <class TeamType, class DT, class... DP>
@@ -529,6 +626,55 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
   }
 }
 
+template <class TeamType, class DT, class... DP, class ST, class... SP>
+void KOKKOS_INLINE_FUNCTION local_deep_copy(
+    const TeamType &team, const View<DT, DP...> &dst,
+    const View<ST, SP...> &src,
+    typename std::enable_if<
+        (unsigned(ViewTraits<DT, DP...>::rank) == 8 &&
+         unsigned(ViewTraits<ST, SP...>::rank) == 8 &&
+         std::is_same<typename ViewTraits<DT, DP...>::specialize,
+                      Kokkos::Experimental::RemoteSpaceSpecializeTag>::value &&
+         std::is_same<typename ViewTraits<ST, SP...>::specialize,
+                      Kokkos::Experimental::RemoteSpaceSpecializeTag>::value)>::
+        type * = nullptr) {
+  if (dst.data() == nullptr) {
+    return;
+  }
+
+  const size_t N = dst.extent(0) * dst.extent(1) * dst.extent(2) *
+                   dst.extent(3) * dst.extent(4) * dst.extent(5) *
+                   dst.extent(6) * dst.extent(7);
+
+  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+    team.team_barrier();
+    Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(team, dst,
+                                                                   src);
+    team.team_barrier();
+  } else {
+    team.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
+      int i0                              = i % dst.extent(0);
+      int itmp                            = i / dst.extent(0);
+      int i1                              = itmp % dst.extent(1);
+      itmp                                = itmp / dst.extent(1);
+      int i2                              = itmp % dst.extent(2);
+      itmp                                = itmp / dst.extent(2);
+      int i3                              = itmp % dst.extent(3);
+      itmp                                = itmp / dst.extent(3);
+      int i4                              = itmp % dst.extent(4);
+      itmp                                = itmp / dst.extent(4);
+      int i5                              = itmp % dst.extent(5);
+      itmp                                = itmp / dst.extent(5);
+      int i6                              = itmp % dst.extent(6);
+      int i7                              = itmp / dst.extent(6);
+      dst(i0, i1, i2, i3, i4, i5, i6, i7) =
+          src(i0, i1, i2, i3, i4, i5, i6, i7);
+    });
+    team.team_barrier();
+  }
+}
+
 template <class DT, class... DP, class ST, class... SP>
 void KOKKOS_INLINE_FUNCTION local_deep_copy(
     const View<DT, DP...> &dst, const View<ST, SP...> &src,
@@ -705,6 +851,37 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
   }
 }
 
+template <class DT, class... DP, class ST, class... SP>
+void KOKKOS_INLINE_FUNCTION local_deep_copy(
+    const View<DT, DP...> &dst, const View<ST, SP...> &src,
+    typename std::enable_if<
+        (unsigned(ViewTraits<DT, DP...>::rank) == 8 &&
+         unsigned(ViewTraits<ST, SP...>::rank) == 8 &&
+         std::is_same<typename ViewTraits<DT, DP...>::specialize,
+                      Kokkos::Experimental::RemoteSpaceSpecializeTag>::value &&
+         std::is_same<typename ViewTraits<ST, SP...>::specialize,
+                      Kokkos::Experimental::RemoteSpaceSpecializeTag>::value)>::
+        type * = nullptr) {
+  if (dst.data() == nullptr) {
+    return;
+  }
+
+  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+    Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(dst, src);
+  } else {
+    for (size_t i0 = 0; i0 < dst.extent(0); ++i0)
+      for (size_t i1 = 0; i1 < dst.extent(1); ++i1)
+        for (size_t i2 = 0; i2 < dst.extent(2); ++i2)
+          for (size_t i3 = 0; i3 < dst.extent(3); ++i3)
+            for (size_t i4 = 0; i4 < dst.extent(4); ++i4)
+              for (size_t i5 = 0; i5 < dst.extent(5); ++i5)
+                for (size_t i6 = 0; i6 < dst.extent(6); ++i6)
+                  for (size_t i7 = 0; i7 < dst.extent(7); ++i7)
+                    dst(i0, i1, i2, i3, i4, i5, i6, i7) =
+                        src(i0, i1, i2, i3, i4, i5, i6, i7);
+  }
+}
+
 // Accepts (team, src_view, value)
 
 template <class TeamType, class DT, class... DP>
@@ -949,6 +1126,51 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
   }
 }
 
+template <class TeamType, class DT, class... DP>
+void KOKKOS_INLINE_FUNCTION local_deep_copy(
+    const TeamType &team, const View<DT, DP...> &dst,
+    typename ViewTraits<DT, DP...>::const_value_type &value,
+    typename std::enable_if<
+        (unsigned(ViewTraits<DT, DP...>::rank) == 8 &&
+         std::is_same<typename ViewTraits<DT, DP...>::specialize,
+                      Kokkos::Experimental::RemoteSpaceSpecializeTag>::value)>::
+        type * = nullptr) {
+  if (dst.data() == nullptr) {
+    return;
+  }
+
+  const size_t N = dst.extent(0) * dst.extent(1) * dst.extent(2) *
+                   dst.extent(3) * dst.extent(4) * dst.extent(5) *
+                   dst.extent(6) * dst.extent(7);
+
+  if (dst.span_is_contiguous()) {
+    team.team_barrier();
+    Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(team, dst,
+                                                                   value);
+    team.team_barrier();
+  } else {
+    team.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
+      int i0                              = i % dst.extent(0);
+      int itmp                            = i / dst.extent(0);
+      int i1                              = itmp % dst.extent(1);
+      itmp                                = itmp / dst.extent(1);
+      int i2                              = itmp % dst.extent(2);
+      itmp                                = itmp / dst.extent(2);
+      int i3                              = itmp % dst.extent(3);
+      itmp                                = itmp / dst.extent(3);
+      int i4                              = itmp % dst.extent(4);
+      itmp                                = itmp / dst.extent(4);
+      int i5                              = itmp % dst.extent(5);
+      itmp                                = itmp / dst.extent(5);
+      int i6                              = itmp % dst.extent(6);
+      int i7                              = itmp / dst.extent(6);
+      dst(i0, i1, i2, i3, i4, i5, i6, i7) = value;
+    });
+    team.team_barrier();
+  }
+}
+
 // Accepts (src_view, value)
 
 template <class DT, class... DP>
@@ -1116,6 +1338,34 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
   }
 }
 
+template <class DT, class... DP>
+void KOKKOS_INLINE_FUNCTION local_deep_copy(
+    const View<DT, DP...> &dst,
+    typename ViewTraits<DT, DP...>::const_value_type &value,
+    typename std::enable_if<
+        (unsigned(ViewTraits<DT, DP...>::rank) == 8 &&
+         std::is_same<typename ViewTraits<DT, DP...>::specialize,
+                      Kokkos::Experimental::RemoteSpaceSpecializeTag>::value)>::
+        type * = nullptr) {
+  if (dst.data() == nullptr) {
+    return;
+  }
+
+  if (dst.span_is_contiguous()) {
+    Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(dst, value);
+  } else {
+    for (size_t i0 = 0; i0 < dst.extent(0); ++i0)
+      for (size_t i1 = 0; i1 < dst.extent(1); ++i1)
+        for (size_t i2 = 0; i2 < dst.extent(2); ++i2)
+          for (size_t i3 = 0; i3 < dst.extent(3); ++i3)
+            for (size_t i4 = 0; i4 < dst.extent(4); ++i4)
+              for (size_t i5 = 0; i5 < dst.extent(5); ++i5)
+                for (size_t i6 = 0; i6 < dst.extent(6); ++i6)
+                  for (size_t i7 = 0; i7 < dst.extent(7); ++i7)
+                    dst(i0, i1, i2, i3, i4, i5, i6, i7) = value;
+  }
+}
+
 }  // namespace RemoteSpaces
 }  // namespace Experimental
 }  // namespace Kokkos
@@ -0,0 +1,155 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_NEIGHBORSYNC_HPP
+#define KOKKOS_REMOTESPACES_NEIGHBORSYNC_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Synchronization of a remote view with a fixed set of neighbor
+ * PEs instead of global fences.
+ *
+ * start() opens an epoch in which this PE accesses the view on its
+ * neighbors and the neighbors access it here; complete() returns once all
+ * of these accesses have completed. Both only synchronize with the
+ * neighbors, so an epoch costs O(#neighbors) messages and does not couple
+ * PEs that do not communicate. The neighbor relation must be symmetric:
+ * every listed PE lists this PE in turn.
+ *
+ * With MPISpace the window of the view is synchronized with
+ * MPI_Win_post/start/complete/wait over the neighbor group while the
+ * NeighborSync exists. Block transfers (deep_copy_async, CommPlan) then
+ * have to be issued between start() and complete(); element accesses go
+ * through a passive-target window and complete immediately, as outside a
+ * NeighborSync. With SHMEMSpace neighbors signal
+ * each other with remote atomic increments. Construction and destruction
+ * are collective; the view stays allocated while the NeighborSync exists.
+ */
+class NeighborSync {
+ public:
+  template <class RemoteView>
+  NeighborSync(const RemoteView &view, std::vector<int> neighbors)
+      : m_track(view.impl_track()) {
+    static_assert(Is_View_Of_Type_RemoteSpaces<RemoteView>::value,
+                  "NeighborSync requires a remote view");
+    const int num_pes = get_num_pes();
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                    neighbors.end());
+    if (!neighbors.empty() &&
+        (neighbors.front() < 0 || neighbors.back() >= num_pes)) {
+      std::string message("Error: NeighborSync neighbors out of range: ");
+      message += view.label();
+      Kokkos::Impl::throw_runtime_exception(message);
+    }
+    m_neighbors = neighbors;
+
+    // Accesses of the previous synchronization model complete here
+    RemoteView::memory_space::fence();
+#ifdef KRS_ENABLE_MPISPACE
+    m_win = view.impl_map().handle().loc.win;
+    if (m_win == MPI_WIN_NULL)
+      Kokkos::Impl::throw_runtime_exception(
+          "Error: NeighborSync requires an allocated remote view");
+    m_fenced = Kokkos::Impl::mpi_window_begin_neighbor_sync(m_win);
+    MPI_Group world;
+    MPI_Comm_group(MPI_COMM_WORLD, &world);
+    MPI_Group_incl(world, m_neighbors.size(), m_neighbors.data(), &m_group);
+    MPI_Group_free(&world);
+#else
+    m_signals = static_cast<uint64_t *>(shmem_calloc(2, sizeof(uint64_t)));
+#endif
+  }
+
+  NeighborSync(const NeighborSync &) = delete;
+  NeighborSync &operator=(const NeighborSync &) = delete;
+
+  ~NeighborSync() {
+    if (m_open) complete();
+#ifdef KRS_ENABLE_MPISPACE
+    MPI_Group_free(&m_group);
+    Kokkos::Impl::mpi_window_end_neighbor_sync(m_win, m_fenced);
+#else
+    shmem_free(m_signals);
+#endif
+  }
+
+  /** \brief  Neighbor PEs, sorted and without duplicates */
+  const std::vector<int> &neighbors() const { return m_neighbors; }
+
+  /** \brief  Opens an epoch once the neighbors are ready to be accessed */
+  void start() {
+    Kokkos::fence("Kokkos::Experimental::RemoteSpaces::NeighborSync::start");
+#ifdef KRS_ENABLE_MPISPACE
+    MPI_Win_post(m_group, 0, m_win);
+    MPI_Win_start(m_group, 0, m_win);
+#else
+    signal(0);
+#endif
+    m_open = true;
+  }
+
+  /** \brief  Closes the epoch once all accesses from and to the neighbors
+   * have completed */
+  void complete() {
+#ifdef KRS_ENABLE_MPISPACE
+    MPI_Win_complete(m_win);
+    MPI_Win_wait(m_win);
+#else
+    signal(1);
+#endif
+    m_open = false;
+  }
+
+ private:
+#ifndef KRS_ENABLE_MPISPACE
+  // Completes outstanding accesses, then signals every neighbor and waits
+  // for the signals of all neighbors
+  void signal(const int k) {
+    shmem_quiet();
+    for (const int pe : m_neighbors) shmem_uint64_atomic_inc(m_signals + k, pe);
+    m_expected[k] += m_neighbors.size();
+    shmem_uint64_wait_until(m_signals + k, SHMEM_CMP_GE, m_expected[k]);
+  }
+#endif
+
+  Kokkos::Impl::SharedAllocationTracker m_track;
+  std::vector<int> m_neighbors;
+  bool m_open = false;
+#ifdef KRS_ENABLE_MPISPACE
+  MPI_Win m_win;
+  MPI_Group m_group;
+  bool m_fenced;
+#else
+  uint64_t *m_signals;
+  uint64_t m_expected[2] = {0, 0};
+#endif
+};
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_NEIGHBORSYNC_HPP
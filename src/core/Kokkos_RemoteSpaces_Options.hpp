@@ -20,11 +20,90 @@
 #define KOKKOS_REMOTESPACES_OPTIONS_HPP
 
 #include <cstdint>
+#include <type_traits>
+
+/* Compile-time number of PEs. Fixed-size jobs can set this (CMake option
+ * KRS_NUM_PES) so that PE-dependent index math folds to constants. Zero
+ * selects the runtime query. */
+#ifndef KRS_NUM_PES
+#define KRS_NUM_PES 0
+#endif
+
+/* Geometry of the read-only line cache (KRS_ENABLE_READONLY_CACHE) */
+#ifndef KRS_READONLY_CACHE_LINE_BYTES
+#define KRS_READONLY_CACHE_LINE_BYTES 512
+#endif
+
+#ifndef KRS_READONLY_CACHE_LINES
+#define KRS_READONLY_CACHE_LINES 8192
+#endif
 
 namespace Kokkos {
 namespace Experimental {
 namespace Impl {
 
+enum : int { RemoteSpaces_StaticNumPEs = KRS_NUM_PES };
+
+static_assert(RemoteSpaces_StaticNumPEs >= 0,
+              "KRS_NUM_PES must be zero (runtime) or a positive PE count");
+
+/* Allocation granularity of padded (Kokkos::AllowPadding) remote views.
+ * Per-PE blocks are rounded to a cache line, or to a page once they span
+ * more than a page, so that block transfers start on NIC-friendly
+ * boundaries. */
+enum : size_t {
+  RemoteSpaces_LineAlignment = 64,
+  RemoteSpaces_PageAlignment = 4096
+};
+
+/* Alignment of the data of an allocation of alloc_size bytes, header
+ * included. Data spanning more than a page starts on a page boundary. */
+constexpr size_t remote_spaces_data_alignment(const size_t alloc_size) {
+  return alloc_size > sizeof(Kokkos::Impl::SharedAllocationHeader) +
+                          size_t(RemoteSpaces_PageAlignment)
+             ? size_t(RemoteSpaces_PageAlignment)
+             : size_t(Kokkos::Impl::MEMORY_ALIGNMENT);
+}
+
+/* Offset from a base aligned to data_alignment at which the allocation
+ * header starts so that the data following it is aligned */
+constexpr size_t remote_spaces_header_offset(const size_t data_alignment) {
+  return (data_alignment -
+          sizeof(Kokkos::Impl::SharedAllocationHeader) % data_alignment) %
+         data_alignment;
+}
+
+/* Views whose remote reads go through RACERlib: random-access, non-atomic
+ * views of const data when the feature is enabled */
+template <class Traits>
+struct RemoteSpaces_Is_RACERlib_Cached {
+#ifdef KRS_ENABLE_RACERLIB
+  enum : bool {
+    value = std::is_const<typename Traits::value_type>::value &&
+            Traits::memory_traits::is_random_access &&
+            !Traits::memory_traits::is_atomic
+  };
+#else
+  enum : bool { value = false };
+#endif
+};
+
+/* Views whose remote reads are served from the per-PE read-only line cache:
+ * non-atomic views of const data when the cache is enabled. Lines are
+ * discarded at fence. */
+template <class Traits>
+struct RemoteSpaces_Is_ReadOnly_Cached {
+#ifdef KRS_ENABLE_READONLY_CACHE
+  enum : bool {
+    value = std::is_const<typename Traits::value_type>::value &&
+            !Traits::memory_traits::is_atomic &&
+            !RemoteSpaces_Is_RACERlib_Cached<Traits>::value
+  };
+#else
+  enum : bool { value = false };
+#endif
+};
+
 enum RemoteSpaces_MemoryTraitFlags { Dim0IsPE = 1 < 0x192 };
 
 template <typename T>
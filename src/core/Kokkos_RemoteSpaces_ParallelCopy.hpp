@@ -0,0 +1,177 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_PARALLELCOPY_HPP
+#define KOKKOS_REMOTESPACES_PARALLELCOPY_HPP
+
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Size of the pieces a host deep_copy or fill is split into across threads */
+#ifndef KRS_PARALLEL_COPY_CHUNK_BYTES
+#define KRS_PARALLEL_COPY_CHUNK_BYTES (1 << 20)
+#endif
+
+/* Copies at least this large bypass the cache with non-temporal stores,
+ * set it to the size of the last level cache of the target */
+#ifndef KRS_NONTEMPORAL_COPY_BYTES
+#define KRS_NONTEMPORAL_COPY_BYTES (32 << 20)
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+/* memcpy with non-temporal stores so that copies larger than the cache do
+ * not evict the working set of other threads */
+inline void remote_spaces_stream_copy(char *dst, const char *src, size_t n) {
+#if defined(__SSE2__)
+  size_t head = (16 - reinterpret_cast<uintptr_t>(dst) % 16) % 16;
+  head        = head < n ? head : n;
+  std::memcpy(dst, src, head);
+  dst += head;
+  src += head;
+  n -= head;
+  const size_t vecs = n / 16;
+  for (size_t i = 0; i < vecs; ++i)
+    _mm_stream_si128(reinterpret_cast<__m128i *>(dst) + i,
+                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(src) +
+                                     i));
+  std::memcpy(dst + vecs * 16, src + vecs * 16, n - vecs * 16);
+  // Order the streaming stores before anything the caller does next
+  _mm_sfence();
+#else
+  std::memcpy(dst, src, n);
+#endif
+}
+
+/* Host memcpy spread across the threads of a host execution space in
+ * chunks of KRS_PARALLEL_COPY_CHUNK_BYTES. The copy is enqueued on exec and
+ * completes with exec.fence(); copies of a single chunk fence exec and run
+ * inline. */
+template <class ExecutionSpace>
+void remote_spaces_parallel_memcpy(const ExecutionSpace &exec, void *dst,
+                                   const void *src, size_t n) {
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace, Kokkos::HostSpace>::accessible,
+      "remote_spaces_parallel_memcpy requires a host execution space");
+
+  constexpr size_t chunk = KRS_PARALLEL_COPY_CHUNK_BYTES;
+  if (n <= chunk || exec.concurrency() == 1) {
+    // Copies inline, ordered after work already enqueued on exec
+    exec.fence();
+    std::memcpy(dst, src, n);
+    return;
+  }
+
+  const bool stream       = n >= size_t(KRS_NONTEMPORAL_COPY_BYTES);
+  const size_t num_chunks = (n + chunk - 1) / chunk;
+  char *d                 = static_cast<char *>(dst);
+  const char *s           = static_cast<const char *>(src);
+
+  Kokkos::parallel_for(
+      "Kokkos::RemoteSpaces::ParallelMemcpy",
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, num_chunks),
+      [=](const size_t c) {
+        const size_t first = c * chunk;
+        const size_t len   = first + chunk < n ? chunk : n - first;
+        if (stream)
+          remote_spaces_stream_copy(d + first, s + first, len);
+        else
+          std::memcpy(d + first, s + first, len);
+      });
+}
+
+/* Host fill of n elements spread across the threads of a host execution
+ * space, enqueued on exec like remote_spaces_parallel_memcpy */
+template <class ExecutionSpace, class T>
+void remote_spaces_parallel_fill(const ExecutionSpace &exec, T *dst, size_t n,
+                                 const T &value) {
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace, Kokkos::HostSpace>::accessible,
+      "remote_spaces_parallel_fill requires a host execution space");
+
+  constexpr size_t chunk = KRS_PARALLEL_COPY_CHUNK_BYTES / sizeof(T) > 0
+                               ? KRS_PARALLEL_COPY_CHUNK_BYTES / sizeof(T)
+                               : 1;
+  if (n <= chunk || exec.concurrency() == 1) {
+    exec.fence();
+    std::fill_n(dst, n, value);
+    return;
+  }
+
+  Kokkos::parallel_for(
+      "Kokkos::RemoteSpaces::ParallelFill",
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, (n + chunk - 1) / chunk),
+      [=](const size_t c) {
+        const size_t first = c * chunk;
+        std::fill_n(dst + first, first + chunk < n ? chunk : n - first, value);
+      });
+}
+
+/* Host memset of n bytes, see remote_spaces_parallel_fill */
+template <class ExecutionSpace>
+void remote_spaces_parallel_memset(const ExecutionSpace &exec, void *dst,
+                                   size_t n) {
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace, Kokkos::HostSpace>::accessible,
+      "remote_spaces_parallel_memset requires a host execution space");
+
+  constexpr size_t chunk = KRS_PARALLEL_COPY_CHUNK_BYTES;
+  if (n <= chunk || exec.concurrency() == 1) {
+    exec.fence();
+    std::memset(dst, 0, n);
+    return;
+  }
+
+  char *d = static_cast<char *>(dst);
+  Kokkos::parallel_for(
+      "Kokkos::RemoteSpaces::ParallelMemset",
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, (n + chunk - 1) / chunk),
+      [=](const size_t c) {
+        const size_t first = c * chunk;
+        std::memset(d + first, 0, first + chunk < n ? chunk : n - first);
+      });
+}
+
+/* Copy for the DeepCopy specializations of host-resident remote spaces.
+ * Runs on exec when it can access host memory, otherwise on the default
+ * host execution space after exec has drained. */
+template <class ExecutionSpace>
+void remote_spaces_host_deep_copy(const ExecutionSpace &exec, void *dst,
+                                  const void *src, size_t n) {
+  if constexpr (Kokkos::SpaceAccessibility<ExecutionSpace,
+                                           Kokkos::HostSpace>::accessible) {
+    remote_spaces_parallel_memcpy(exec, dst, src, n);
+  } else {
+    exec.fence();
+    Kokkos::DefaultHostExecutionSpace host;
+    remote_spaces_parallel_memcpy(host, dst, src, n);
+    host.fence();
+  }
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_PARALLELCOPY_HPP
@@ -0,0 +1,181 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_PREFETCH_HPP
+#define KOKKOS_REMOTESPACES_PREFETCH_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Handle to a non-blocking fetch of a dim0 range of a remote view
+ * into host staging memory.
+ *
+ * The range is split at PE boundaries and every part is read with one
+ * non-blocking block get. After wait(), reads through the handle with the
+ * view's own indices resolve to the staging copy; reads through the view
+ * itself still go to remote memory. The staged data is a snapshot: it does
+ * not observe writes issued after prefetch(). Not supported on subviews or
+ * on fenced or neighbor-synchronized MPISpace allocations.
+ */
+template <class ViewType>
+class PrefetchHandle {
+ public:
+  using value_type   = std::remove_const_t<typename ViewType::value_type>;
+  using size_type    = typename ViewType::size_type;
+  using range_type   = Kokkos::pair<size_type, size_type>;
+  using staging_type = Kokkos::View<value_type *, Kokkos::HostSpace>;
+
+  static_assert(ViewType::rank > 0, "prefetch requires a view of rank > 0");
+  static_assert(
+      ViewType::rank == 1 || Is_Partitioned_Layout<ViewType>::value ||
+          std::is_same<typename ViewType::array_layout,
+                       Kokkos::LayoutRight>::value,
+      "prefetch requires dim0 slabs that are contiguous in remote memory");
+
+  PrefetchHandle() = default;
+
+  PrefetchHandle(const ViewType &view, const range_type &range)
+      : m_view(view),
+        m_range(range),
+        m_pending(std::make_shared<Pending>()) {
+    const auto &map = view.impl_map();
+    // Subviews index dim0 relative to their range or their PE
+    if (map.remote_view_props.using_local_indexing ||
+        map.remote_view_props.R0_offset != 0)
+      Kokkos::Impl::throw_runtime_exception(
+          "prefetch is not supported on subviews");
+#ifdef KRS_ENABLE_MPISPACE
+    if (Kokkos::Impl::mpi_window_is_fenced(map.handle().loc))
+      Kokkos::Impl::throw_runtime_exception(
+          "prefetch is not supported on fenced or neighbor-synchronized "
+          "MPISpace allocations");
+#endif
+    // Number of dim0 indices held by a PE and elements per dim0 index
+    size_type block;
+    if constexpr (Is_Partitioned_Layout<ViewType>::value) {
+      block   = 1;
+      m_elems = map.span();
+    } else {
+      block   = map.is_single_PE() ? view.extent(0) : map.get_R0_size();
+      m_elems = ViewType::rank == 1 ? 1 : map.stride_0();
+    }
+
+    m_staging = staging_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "PrefetchStaging"),
+        (range.second - range.first) * m_elems);
+
+    for (size_type first = range.first; first < range.second;) {
+      const int pe = int(first / block);
+      const size_type last =
+          std::min(size_type(pe + 1) * block, size_type(range.second));
+      const size_type local_offset = (first - size_type(pe) * block) * m_elems;
+      const size_t nbytes = (last - first) * m_elems * sizeof(value_type);
+      value_type *dst     = m_staging.data() + (first - range.first) * m_elems;
+#ifdef KRS_ENABLE_MPISPACE
+      m_pending->requests.emplace_back();
+      Kokkos::Impl::mpi_block_get_nbi(
+          dst,
+          sizeof(Kokkos::Impl::SharedAllocationHeader) +
+              (map.handle().loc.offset + local_offset) * sizeof(value_type),
+          nbytes, pe, map.handle().loc, &m_pending->requests.back());
+#else
+      Kokkos::Impl::shmem_block_get_nbi(dst, map.handle().ptr + local_offset,
+                                        nbytes, pe);
+      m_pending->outstanding = true;
+#endif
+      first = last;
+    }
+  }
+
+  /** \brief  Completes the transfers; idempotent */
+  void wait() const {
+    if (m_pending) m_pending->wait();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool contains(const size_type i0) const {
+    return i0 >= m_range.first && i0 < m_range.second;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  range_type range() const { return m_range; }
+
+  /** \brief  Staged elements, dim0 slabs in range order */
+  KOKKOS_INLINE_FUNCTION
+  staging_type staging() const { return m_staging; }
+
+  /** \brief  Staged element at the given view indices */
+  template <typename I0, typename... Is>
+  KOKKOS_INLINE_FUNCTION value_type operator()(const I0 &i0,
+                                               const Is &... is) const {
+    return m_staging((size_type(i0) - m_range.first) * m_elems +
+                     m_view.impl_map().m_offset(0, is...));
+  }
+
+ private:
+  struct Pending {
+#ifdef KRS_ENABLE_MPISPACE
+    std::vector<MPI_Request> requests;
+    void wait() {
+      MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+      requests.clear();
+    }
+#else
+    bool outstanding = false;
+    void wait() {
+      if (outstanding) shmem_quiet();
+      outstanding = false;
+    }
+#endif
+    // Staging memory must not be released while transfers are in flight
+    ~Pending() { wait(); }
+  };
+
+  ViewType m_view;
+  range_type m_range;
+  size_type m_elems = 0;
+  staging_type m_staging;
+  std::shared_ptr<Pending> m_pending;
+};
+
+/** \brief  Starts fetching the dim0 range [range.first, range.second) of a
+ * remote view into local staging memory and returns its handle.
+ *
+ * For global layouts dim0 indices are global, for partitioned layouts they
+ * are PE ids. Throws if the view is a subview.
+ */
+template <class ViewType>
+PrefetchHandle<ViewType> prefetch(
+    const ViewType &view,
+    const typename PrefetchHandle<ViewType>::range_type &range) {
+  static_assert(Is_View_Of_Type_RemoteSpaces<ViewType>::value,
+                "prefetch requires a remote view");
+  return PrefetchHandle<ViewType>(view, range);
+}
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_PREFETCH_HPP
@@ -0,0 +1,235 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_REDISTRIBUTE_HPP
+#define KOKKOS_REMOTESPACES_REDISTRIBUTE_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <climits>
+#include <cstring>
+#include <vector>
+
+namespace Kokkos {
+namespace Impl {
+
+/* Distribution of a remote view seen as one global array in row-major order
+ * of its global indices. PE p owns the global dim0 rows [p * rows, (p + 1) *
+ * rows), which is the contiguous range of linear indices [begin(p), end(p)).
+ * Global layouts own R0_size rows per PE, partitioned layouts own one. */
+template <class ViewType>
+struct RemoteSpaces_Distribution {
+  static constexpr unsigned rank = ViewType::rank;
+  static constexpr bool is_row_major =
+      rank == 1 ||
+      std::is_same<typename ViewType::array_layout,
+                   Kokkos::LayoutRight>::value ||
+      std::is_same<typename ViewType::array_layout,
+                   Kokkos::PartitionedLayoutRight>::value;
+
+  size_t extents[8] = {1, 1, 1, 1, 1, 1, 1, 1};
+  size_t rows       = 1;
+  size_t row_elems  = 1;
+  int num_pes       = 1;
+  bool contiguous   = false;
+
+  explicit RemoteSpaces_Distribution(const ViewType &view) {
+    const auto &map = view.impl_map();
+    num_pes         = map.remote_view_props.num_PEs;
+    if (num_pes < 1) num_pes = 1;
+    if constexpr (!Kokkos::Experimental::Is_Partitioned_Layout<
+                      ViewType>::value)
+      rows = map.get_R0_size();
+    extents[0] = rows * num_pes;
+    for (unsigned r = 1; r < rank; ++r) {
+      extents[r] = view.extent(r);
+      row_elems *= extents[r];
+    }
+    contiguous = is_row_major && view.span_is_contiguous();
+  }
+
+  size_t begin(const int pe) const { return pe * rows * row_elems; }
+  size_t end(const int pe) const { return begin(pe + 1); }
+  size_t size() const { return begin(num_pes); }
+
+  // Local offset, on PE pe, of the element with global linear index g
+  size_t local_offset(const ViewType &view, const int pe,
+                      const size_t g) const {
+    size_t l = g - begin(pe);
+    if (contiguous) return l;
+    size_t i[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (unsigned r = rank - 1; r > 0; --r) {
+      i[r] = l % extents[r];
+      l /= extents[r];
+    }
+    // Partitioned layouts index their single local row with 0
+    if constexpr (!Kokkos::Experimental::Is_Partitioned_Layout<
+                      ViewType>::value)
+      i[0] = l;
+    const auto &o = view.impl_map().m_offset;
+    if constexpr (rank == 1) return o(i[0]);
+    if constexpr (rank == 2) return o(i[0], i[1]);
+    if constexpr (rank == 3) return o(i[0], i[1], i[2]);
+    if constexpr (rank == 4) return o(i[0], i[1], i[2], i[3]);
+    if constexpr (rank == 5) return o(i[0], i[1], i[2], i[3], i[4]);
+    if constexpr (rank == 6) return o(i[0], i[1], i[2], i[3], i[4], i[5]);
+    if constexpr (rank == 7)
+      return o(i[0], i[1], i[2], i[3], i[4], i[5], i[6]);
+    if constexpr (rank == 8)
+      return o(i[0], i[1], i[2], i[3], i[4], i[5], i[6], i[7]);
+  }
+
+  // Copies the local elements with global linear indices [first, last)
+  // between the view and a contiguous buffer
+  template <class T>
+  void transfer(const ViewType &view, const int pe, const size_t first,
+                const size_t last, T *buf, const bool pack) const {
+    T *data = view.data();
+    if (contiguous) {
+      T *local = data + (first - begin(pe));
+      if (pack)
+        std::memcpy(buf, local, (last - first) * sizeof(T));
+      else
+        std::memcpy(local, buf, (last - first) * sizeof(T));
+      return;
+    }
+    for (size_t g = first; g < last; ++g) {
+      T &elem = data[local_offset(view, pe, g)];
+      if (pack)
+        buf[g - first] = elem;
+      else
+        elem = buf[g - first];
+    }
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+namespace RemoteSpaces {
+
+/* Collective copy between two remote views of the same value type that may
+ * differ in layout, rank and block distribution. Both views are read as
+ * global arrays in row-major order of their global indices, where global
+ * layouts contribute their padded dim0 extent (block size times number of
+ * PEs). Padding rows trail in that order, so the leading elements common to
+ * both views are copied. Since partitions are contiguous in that order, the
+ * overlap of any source and destination partition is a single interval:
+ * every PE derives its send and receive counts locally and the data moves
+ * with one MPI_Alltoallv. Must be called by all PEs. */
+template <class DstType, class SrcType>
+void redistribute(const DstType &dst, const SrcType &src) {
+  static_assert(Is_View_Of_Type_RemoteSpaces<DstType>::value &&
+                    Is_View_Of_Type_RemoteSpaces<SrcType>::value,
+                "redistribute requires remote views");
+  static_assert(std::is_same<typename DstType::value_type,
+                             typename DstType::non_const_value_type>::value,
+                "redistribute requires non-const destination view");
+  static_assert(std::is_same<typename DstType::non_const_value_type,
+                             typename SrcType::non_const_value_type>::value,
+                "redistribute requires views of the same value type");
+
+  using value_type = typename DstType::non_const_value_type;
+
+  if (dst.impl_map().remote_view_props.using_local_indexing ||
+      src.impl_map().remote_view_props.using_local_indexing)
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::RemoteSpaces::redistribute: subviews are not "
+        "supported");
+
+  const Kokkos::Impl::RemoteSpaces_Distribution<DstType> dst_dist(dst);
+  const Kokkos::Impl::RemoteSpaces_Distribution<SrcType> src_dist(src);
+
+  int my_pe, num_pes;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_pe);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_pes);
+
+  if (dst_dist.num_pes != num_pes || src_dist.num_pes != num_pes)
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::RemoteSpaces::redistribute: views must be "
+        "distributed over all PEs");
+
+  const size_t count =
+      dst_dist.size() < src_dist.size() ? dst_dist.size() : src_dist.size();
+
+  // Complete pending local and one-sided writes to the source
+  Kokkos::fence();
+  SrcType::memory_space::fence();
+
+  auto overlap = [count](size_t a0, size_t a1, size_t b0, size_t b1) {
+    const size_t lo = a0 > b0 ? a0 : b0;
+    size_t hi       = a1 < b1 ? a1 : b1;
+    hi              = hi < count ? hi : count;
+    return Kokkos::pair<size_t, size_t>(lo, hi > lo ? hi : lo);
+  };
+
+  std::vector<int> send_counts(num_pes), send_displs(num_pes);
+  std::vector<int> recv_counts(num_pes), recv_displs(num_pes);
+  size_t send_total = 0, recv_total = 0;
+  for (int pe = 0; pe < num_pes; ++pe) {
+    auto s = overlap(src_dist.begin(my_pe), src_dist.end(my_pe),
+                     dst_dist.begin(pe), dst_dist.end(pe));
+    auto r = overlap(src_dist.begin(pe), src_dist.end(pe),
+                     dst_dist.begin(my_pe), dst_dist.end(my_pe));
+    const size_t s_bytes = (s.second - s.first) * sizeof(value_type);
+    const size_t r_bytes = (r.second - r.first) * sizeof(value_type);
+    if (send_total + s_bytes > INT_MAX || recv_total + r_bytes > INT_MAX)
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::RemoteSpaces::redistribute: partition "
+          "exceeds 2GB");
+    send_counts[pe] = s_bytes;
+    send_displs[pe] = send_total;
+    recv_counts[pe] = r_bytes;
+    recv_displs[pe] = recv_total;
+    send_total += s_bytes;
+    recv_total += r_bytes;
+  }
+
+  // Overlaps are visited in increasing global order on both sides, so the
+  // packed send buffer of one PE lines up with the receive buffer of another
+  std::vector<value_type> send_buf(send_total / sizeof(value_type));
+  std::vector<value_type> recv_buf(recv_total / sizeof(value_type));
+
+  for (int pe = 0; pe < num_pes; ++pe) {
+    auto s = overlap(src_dist.begin(my_pe), src_dist.end(my_pe),
+                     dst_dist.begin(pe), dst_dist.end(pe));
+    src_dist.transfer(src, my_pe, s.first, s.second,
+                      send_buf.data() + send_displs[pe] / sizeof(value_type),
+                      true);
+  }
+
+  MPI_Alltoallv(send_buf.data(), send_counts.data(), send_displs.data(),
+                MPI_BYTE, recv_buf.data(), recv_counts.data(),
+                recv_displs.data(), MPI_BYTE, MPI_COMM_WORLD);
+
+  for (int pe = 0; pe < num_pes; ++pe) {
+    auto r = overlap(src_dist.begin(pe), src_dist.end(pe),
+                     dst_dist.begin(my_pe), dst_dist.end(my_pe));
+    dst_dist.transfer(dst, my_pe, r.first, r.second,
+                      recv_buf.data() + recv_displs[pe] / sizeof(value_type),
+                      false);
+  }
+
+  // Make the redistributed partitions visible to all PEs
+  DstType::memory_space::fence();
+}
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_REDISTRIBUTE_HPP
@@ -0,0 +1,306 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_ROOTTRANSFERS_HPP
+#define KOKKOS_REMOTESPACES_ROOTTRANSFERS_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <cstring>
+#include <vector>
+
+/* Bytes of a full-array host view moved per round by gather_to, allgather
+ * and scatter_from. Larger views are transferred in pipelined rounds
+ * through two staging buffers of this size. */
+#ifndef KRS_ROOT_TRANSFER_CHUNK_BYTES
+#define KRS_ROOT_TRANSFER_CHUNK_BYTES (64 << 20)
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+/* Placement of the local partitions of a whole global or partitioned remote
+ * view inside a host view holding the full array. Local partitions are
+ * treated as flat spans; rows past the extent of the host view (padding of
+ * the last PEs) are not transferred. */
+template <class RemoteView>
+struct RemoteSpaces_RootLayout {
+  using value_type = typename RemoteView::non_const_value_type;
+
+  static constexpr bool is_left =
+      RemoteView::rank > 1 &&
+      (std::is_same<typename RemoteView::array_layout,
+                    Kokkos::LayoutLeft>::value ||
+       std::is_same<typename RemoteView::array_layout,
+                    Kokkos::PartitionedLayoutLeft>::value);
+
+  size_t rows;        // dim0 rows per PE
+  size_t row_elems;   // elements per dim0 row
+  size_t local_size;  // elements per PE
+  size_t host_rows;   // dim0 extent of the host view
+
+  template <class HostView>
+  RemoteSpaces_RootLayout(const RemoteView &remote, const HostView &host,
+                          const int num_pes, const bool check_host) {
+    static_assert(RemoteView::rank == HostView::rank,
+                  "Host view must have the rank of the remote view");
+    static_assert(
+        is_left ==
+            (HostView::rank > 1 && std::is_same<typename HostView::array_layout,
+                                                Kokkos::LayoutLeft>::value),
+        "Host view must be LayoutLeft exactly when the remote view is");
+
+    const auto &map = remote.impl_map();
+    if (map.remote_view_props.using_local_indexing ||
+        !remote.span_is_contiguous())
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::RemoteSpaces: root transfers require a "
+          "whole remote view");
+
+    rows = 1;
+    if constexpr (!Kokkos::Experimental::Is_Partitioned_Layout<
+                      RemoteView>::value)
+      rows = map.get_R0_size();
+    row_elems = 1;
+    for (unsigned r = 1; r < RemoteView::rank; ++r)
+      row_elems *= remote.extent(r);
+    local_size = rows * row_elems;
+    host_rows  = host.extent(0);
+
+    if (!check_host) return;
+    bool valid = host.span_is_contiguous() && host_rows <= rows * num_pes;
+    for (unsigned r = 1; r < RemoteView::rank; ++r)
+      valid &= host.extent(r) == remote.extent(r);
+    if (!valid)
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::RemoteSpaces: host view does not match the "
+          "global extents of the remote view");
+  }
+
+  // Copies local elements [first, last) of PE pe between a contiguous buffer
+  // and the host array, in runs of consecutive host elements
+  void transfer(value_type *host, value_type *buf, const int pe,
+                const size_t first, const size_t last,
+                const bool to_host) const {
+    auto copy = [&](const size_t h, const size_t b, const size_t n) {
+      if (to_host)
+        std::memcpy(host + h, buf + b, n * sizeof(value_type));
+      else
+        std::memcpy(buf + b, host + h, n * sizeof(value_type));
+    };
+    const size_t row0 = pe * rows;
+    if (row0 >= host_rows) return;
+    const size_t valid_rows = host_rows - row0 < rows ? host_rows - row0 : rows;
+    if (!is_left) {
+      // Row-major: the partition is one run of the host array
+      const size_t end = valid_rows * row_elems < last ? valid_rows * row_elems
+                                                       : last;
+      if (end > first) copy(row0 * row_elems + first, 0, end - first);
+      return;
+    }
+    // Column-major: one run per column of the partition
+    size_t l = first;
+    while (l < last) {
+      const size_t r = l % rows, c = l / rows;
+      const size_t col_end = (c + 1) * rows < last ? (c + 1) * rows : last;
+      const size_t r_end   = r + (col_end - l);
+      if (r < valid_rows)
+        copy(row0 + r + host_rows * c, l - first,
+             (r_end < valid_rows ? r_end : valid_rows) - r);
+      l = col_end;
+    }
+  }
+};
+
+/* Rounds of a root transfer: every PE moves the same slice [k * slice,
+ * (k + 1) * slice) of its local partition per round. */
+struct RemoteSpaces_RootRounds {
+  size_t slice;
+  size_t count;
+
+  RemoteSpaces_RootRounds(const size_t local_size, const size_t elem_bytes,
+                          const int num_pes) {
+    size_t max_slice = KRS_ROOT_TRANSFER_CHUNK_BYTES / (elem_bytes * num_pes);
+    slice            = max_slice > 0 ? max_slice : 1;
+    slice            = local_size < slice ? local_size : slice;
+    count            = slice > 0 ? (local_size + slice - 1) / slice : 0;
+  }
+
+  size_t first(const size_t k) const { return k * slice; }
+  size_t last(const size_t k, const size_t local_size) const {
+    return (k + 1) * slice < local_size ? (k + 1) * slice : local_size;
+  }
+};
+
+/* Gathers the local partitions into host on the root, or on all PEs */
+template <class HostView, class RemoteView>
+void remote_spaces_gather(const int root, const HostView &host,
+                          const RemoteView &remote, const bool all) {
+  using value_type = typename RemoteView::non_const_value_type;
+  static_assert(std::is_same<typename HostView::value_type, value_type>::value,
+                "Host view must have the non-const value type of the remote "
+                "view");
+
+  int my_pe, num_pes;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_pe);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_pes);
+
+  const bool receives = all || my_pe == root;
+  const RemoteSpaces_RootLayout<RemoteView> layout(remote, host, num_pes,
+                                                   receives);
+  const RemoteSpaces_RootRounds rounds(layout.local_size, sizeof(value_type),
+                                       num_pes);
+
+  // Remote writes to any partition must have landed
+  Kokkos::fence();
+  RemoteView::memory_space::fence();
+
+  const value_type *local = remote.data();
+  std::vector<value_type> staging[2];
+  if (receives)
+    for (auto &buf : staging) buf.resize(rounds.slice * num_pes);
+
+  auto unpack = [&](const size_t k) {
+    const size_t first = rounds.first(k);
+    const size_t last  = rounds.last(k, layout.local_size);
+    value_type *buf    = staging[k % 2].data();
+    for (int pe = 0; pe < num_pes; ++pe)
+      layout.transfer(host.data(), buf + pe * (last - first), pe, first, last,
+                      true);
+  };
+
+  // Round k + 1 is in flight while round k is unpacked
+  MPI_Request request = MPI_REQUEST_NULL;
+  for (size_t k = 0; k < rounds.count; ++k) {
+    const size_t first = rounds.first(k);
+    const int bytes =
+        (rounds.last(k, layout.local_size) - first) * sizeof(value_type);
+    value_type *recv = receives ? staging[k % 2].data() : nullptr;
+    MPI_Request next;
+    if (all)
+      MPI_Iallgather(local + first, bytes, MPI_BYTE, recv, bytes, MPI_BYTE,
+                     MPI_COMM_WORLD, &next);
+    else
+      MPI_Igather(local + first, bytes, MPI_BYTE, recv, bytes, MPI_BYTE, root,
+                  MPI_COMM_WORLD, &next);
+    if (k > 0) {
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+      if (receives) unpack(k - 1);
+    }
+    request = next;
+  }
+  if (rounds.count > 0) {
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+    if (receives) unpack(rounds.count - 1);
+  }
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Collects a whole global or partitioned remote view into a host
+ * view holding the full array on PE root.
+ *
+ * The host view has the rank and left/right layout of the remote view and
+ * its global extents: dim0 may drop the padding rows of the last PEs and is
+ * the number of PEs for partitioned layouts. It is ignored on other PEs.
+ * Collective; large views move in pipelined rounds of
+ * KRS_ROOT_TRANSFER_CHUNK_BYTES.
+ */
+template <class HostView, class RemoteView>
+void gather_to(const int root, const HostView &host_view,
+               const RemoteView &remote_view) {
+  Kokkos::Impl::remote_spaces_gather(root, host_view, remote_view, false);
+}
+
+/** \brief  Like gather_to, with the full array delivered to every PE. */
+template <class HostView, class RemoteView>
+void allgather(const HostView &host_view, const RemoteView &remote_view) {
+  Kokkos::Impl::remote_spaces_gather(0, host_view, remote_view, true);
+}
+
+/** \brief  Distributes a host view holding the full array on PE root into
+ * the local partitions of a whole global or partitioned remote view.
+ *
+ * The inverse of gather_to; partition rows past the host extent are left
+ * untouched. Collective; the remote view is fenced on return.
+ */
+template <class RemoteView, class HostView>
+void scatter_from(const int root, const RemoteView &remote_view,
+                  const HostView &host_view) {
+  using value_type = typename RemoteView::non_const_value_type;
+  static_assert(std::is_same<typename HostView::non_const_value_type,
+                             value_type>::value,
+                "Host view must have the value type of the remote view");
+  static_assert(std::is_same<typename RemoteView::value_type,
+                             value_type>::value,
+                "scatter_from requires a non-const remote view");
+
+  int my_pe, num_pes;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_pe);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_pes);
+
+  const bool sends = my_pe == root;
+  const Kokkos::Impl::RemoteSpaces_RootLayout<RemoteView> layout(
+      remote_view, host_view, num_pes, sends);
+  const Kokkos::Impl::RemoteSpaces_RootRounds rounds(
+      layout.local_size, sizeof(value_type), num_pes);
+
+  // Nobody may still access the partitions being overwritten
+  Kokkos::fence();
+  RemoteView::memory_space::fence();
+
+  value_type *local = remote_view.data();
+  auto *host = const_cast<value_type *>(host_view.data());
+  std::vector<value_type> staging[2];
+  if (sends)
+    for (auto &buf : staging) buf.resize(rounds.slice * num_pes);
+
+  auto pack = [&](const size_t k) {
+    const size_t first = rounds.first(k);
+    const size_t last  = rounds.last(k, layout.local_size);
+    value_type *buf    = staging[k % 2].data();
+    for (int pe = 0; pe < num_pes; ++pe)
+      layout.transfer(host, buf + pe * (last - first), pe, first, last, false);
+  };
+
+  // Round k + 1 is packed while round k is in flight
+  MPI_Request request = MPI_REQUEST_NULL;
+  if (sends && rounds.count > 0) pack(0);
+  for (size_t k = 0; k < rounds.count; ++k) {
+    const size_t first = rounds.first(k);
+    const int bytes =
+        (rounds.last(k, layout.local_size) - first) * sizeof(value_type);
+    if (k > 0) MPI_Wait(&request, MPI_STATUS_IGNORE);
+    MPI_Iscatter(sends ? staging[k % 2].data() : nullptr, bytes, MPI_BYTE,
+                 local + first, bytes, MPI_BYTE, root, MPI_COMM_WORLD,
+                 &request);
+    if (sends && k + 1 < rounds.count) pack(k + 1);
+  }
+  MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+  // Partitions written by the scatter are visible to remote readers
+  RemoteView::memory_space::fence();
+}
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_ROOTTRANSFERS_HPP
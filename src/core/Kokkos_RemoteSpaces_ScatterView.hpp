@@ -0,0 +1,235 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_SCATTERVIEW_HPP
+#define KOKKOS_REMOTESPACES_SCATTERVIEW_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <Kokkos_ScatterView.hpp>
+#include <mpi.h>
+
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+template <class T>
+struct RemoteSpaces_MPIDatatype;
+
+#define KOKKOS_REMOTESPACES_MPI_DATATYPE(type, mpi_type) \
+  template <>                                            \
+  struct RemoteSpaces_MPIDatatype<type> {                \
+    static MPI_Datatype get() { return mpi_type; }       \
+  };
+
+KOKKOS_REMOTESPACES_MPI_DATATYPE(char, MPI_CHAR)
+KOKKOS_REMOTESPACES_MPI_DATATYPE(unsigned char, MPI_UNSIGNED_CHAR)
+KOKKOS_REMOTESPACES_MPI_DATATYPE(short, MPI_SHORT)
+KOKKOS_REMOTESPACES_MPI_DATATYPE(unsigned short, MPI_UNSIGNED_SHORT)
+KOKKOS_REMOTESPACES_MPI_DATATYPE(int, MPI_INT)
+KOKKOS_REMOTESPACES_MPI_DATATYPE(unsigned int, MPI_UNSIGNED)
+KOKKOS_REMOTESPACES_MPI_DATATYPE(long, MPI_LONG)
+KOKKOS_REMOTESPACES_MPI_DATATYPE(unsigned long, MPI_UNSIGNED_LONG)
+KOKKOS_REMOTESPACES_MPI_DATATYPE(long long, MPI_LONG_LONG)
+KOKKOS_REMOTESPACES_MPI_DATATYPE(unsigned long long, MPI_UNSIGNED_LONG_LONG)
+KOKKOS_REMOTESPACES_MPI_DATATYPE(float, MPI_FLOAT)
+KOKKOS_REMOTESPACES_MPI_DATATYPE(double, MPI_DOUBLE)
+
+#undef KOKKOS_REMOTESPACES_MPI_DATATYPE
+
+/* Identity, MPI reduction and host-side combine of a ScatterView op */
+template <class Op, class T>
+struct RemoteSpaces_ScatterOpTraits;
+
+template <class T>
+struct RemoteSpaces_ScatterOpTraits<Kokkos::Experimental::ScatterSum, T> {
+  static T identity() { return Kokkos::reduction_identity<T>::sum(); }
+  static MPI_Op mpi_op() { return MPI_SUM; }
+  static void combine(T &dst, const T &src) { dst += src; }
+};
+
+template <class T>
+struct RemoteSpaces_ScatterOpTraits<Kokkos::Experimental::ScatterProd, T> {
+  static T identity() { return Kokkos::reduction_identity<T>::prod(); }
+  static MPI_Op mpi_op() { return MPI_PROD; }
+  static void combine(T &dst, const T &src) { dst *= src; }
+};
+
+template <class T>
+struct RemoteSpaces_ScatterOpTraits<Kokkos::Experimental::ScatterMin, T> {
+  static T identity() { return Kokkos::reduction_identity<T>::min(); }
+  static MPI_Op mpi_op() { return MPI_MIN; }
+  static void combine(T &dst, const T &src) { dst = src < dst ? src : dst; }
+};
+
+template <class T>
+struct RemoteSpaces_ScatterOpTraits<Kokkos::Experimental::ScatterMax, T> {
+  static T identity() { return Kokkos::reduction_identity<T>::max(); }
+  static MPI_Op mpi_op() { return MPI_MAX; }
+  static void combine(T &dst, const T &src) { dst = src > dst ? src : dst; }
+};
+
+}  // namespace Impl
+
+namespace RemoteSpaces {
+
+/** \brief  ScatterView across PEs for a rank-1 remote view.
+ *
+ * Every PE accumulates contributions into a local buffer through
+ * scatter_view(), a Kokkos::Experimental::ScatterView that handles
+ * contention between the threads of the PE. contribute() then combines the
+ * buffers of all PEs into the owning PEs with one bulk exchange instead of
+ * one remote atomic per update.
+ *
+ * A dense RemoteScatterView buffers the whole global index space and
+ * contributes with MPI_Reduce_scatter_block. A sparse RemoteScatterView only
+ * buffers a given list of global indices; its scatter view is then indexed
+ * by slot, remapped_indices()(k) being the slot of indices(k). Its
+ * contributions are exchanged with one MPI_Alltoallv and combined by the
+ * owners.
+ *
+ * Subviews and views mapped to a single PE while several PEs run are
+ * rejected. Construction and contribute() are collective over all PEs.
+ */
+template <class ViewType, class Op = Kokkos::Experimental::ScatterSum>
+class RemoteScatterView {
+ public:
+  using value_type   = std::remove_const_t<typename ViewType::value_type>;
+  using size_type    = typename ViewType::size_type;
+  using buffer_type  = Kokkos::View<value_type *, Kokkos::LayoutRight,
+                                   Kokkos::DefaultExecutionSpace>;
+  using scatter_type = Kokkos::Experimental::ScatterView<
+      value_type *, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace, Op>;
+  using remap_type   = Impl::RemoteSpaces_IndexLists::remap_type;
+
+  static_assert(Is_View_Of_Type_RemoteSpaces<ViewType>::value,
+                "RemoteScatterView requires a remote view");
+  static_assert(ViewType::rank == 1 && !Is_Partitioned_Layout<ViewType>::value,
+                "RemoteScatterView requires a rank-1 view with a global "
+                "layout");
+
+  RemoteScatterView() = default;
+
+  /** \brief  Dense contribution buffer over all global indices of view */
+  explicit RemoteScatterView(const ViewType &view) : m_view(view) {
+    MPI_Comm_size(MPI_COMM_WORLD, &m_num_pes);
+    m_block = Impl::remote_spaces_index_block(view, "RemoteScatterView");
+    m_dense = true;
+    // Padded to a whole block per PE as required by the reduce-scatter
+    init_buffer(size_t(m_block) * m_num_pes);
+  }
+
+  /** \brief  Sparse contribution buffer over the global indices listed */
+  template <class IndexView>
+  RemoteScatterView(const ViewType &view, const IndexView &indices)
+      : m_view(view) {
+    MPI_Comm_size(MPI_COMM_WORLD, &m_num_pes);
+    // Send lists: local offsets on every owning PE
+    const Impl::RemoteSpaces_IndexLists lists(view, indices,
+                                              "RemoteScatterView");
+    m_remap = lists.remap;
+
+    // Receive lists: local offsets contributed to by every other PE
+    std::vector<int> recv_counts, recv_displs;
+    lists.exchange(recv_counts, recv_displs, m_recv_offsets);
+
+    const int elem_bytes = sizeof(value_type);
+
+    m_send_counts = Impl::remote_spaces_to_bytes(lists.counts, elem_bytes);
+    m_send_displs = Impl::remote_spaces_to_bytes(lists.displs, elem_bytes);
+    m_recv_counts = Impl::remote_spaces_to_bytes(recv_counts, elem_bytes);
+    m_recv_displs = Impl::remote_spaces_to_bytes(recv_displs, elem_bytes);
+    m_recv.resize(m_recv_offsets.size());
+    init_buffer(lists.size());
+  }
+
+  /** \brief  Slot of every index of the list given to a sparse view */
+  remap_type remapped_indices() const { return m_remap; }
+
+  /** \brief  Number of buffered entries */
+  size_type buffer_size() const { return m_buffer.extent(0); }
+
+  /** \brief  ScatterView over the local contribution buffer; kernels
+   * capture it and update through its access() */
+  scatter_type scatter_view() const { return m_scatter; }
+
+  /** \brief  Combines the contributions of all PEs into the owned elements
+   * of the view and resets the buffers.
+   *
+   * Collective. A RemoteSpace fence is needed before remote reads of the
+   * updated elements.
+   */
+  void contribute() {
+    using traits = Impl::RemoteSpaces_ScatterOpTraits<Op, value_type>;
+    m_scatter.contribute_into(m_buffer);
+    auto h_buffer =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m_buffer);
+    value_type *local = m_view.data();
+
+    if (m_dense) {
+      // Every PE allocates a whole block, padding included
+      m_recv.resize(m_block);
+      MPI_Reduce_scatter_block(
+          h_buffer.data(), m_recv.data(), m_block,
+          Impl::RemoteSpaces_MPIDatatype<value_type>::get(), traits::mpi_op(),
+          MPI_COMM_WORLD);
+      for (int64_t j = 0; j < m_block; ++j)
+        traits::combine(local[j], m_recv[j]);
+    } else {
+      MPI_Alltoallv(h_buffer.data(), m_send_counts.data(),
+                    m_send_displs.data(), MPI_BYTE, m_recv.data(),
+                    m_recv_counts.data(), m_recv_displs.data(), MPI_BYTE,
+                    MPI_COMM_WORLD);
+      // Offsets may repeat across senders, hence sequential
+      for (size_t k = 0; k < m_recv.size(); ++k)
+        traits::combine(local[m_recv_offsets[k]], m_recv[k]);
+    }
+
+    m_scatter.reset_except(m_buffer);
+    Kokkos::deep_copy(m_buffer, traits::identity());
+  }
+
+ private:
+  void init_buffer(size_t n) {
+    using traits = Impl::RemoteSpaces_ScatterOpTraits<Op, value_type>;
+    m_buffer     = buffer_type(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "ScatterViewBuffer"),
+        n);
+    Kokkos::deep_copy(m_buffer, traits::identity());
+    m_scatter = scatter_type(m_buffer);
+  }
+
+  ViewType m_view;
+  int m_num_pes   = 1;
+  int64_t m_block = 0;
+  bool m_dense    = false;
+  buffer_type m_buffer;
+  scatter_type m_scatter;
+  remap_type m_remap;
+  std::vector<int64_t> m_recv_offsets;
+  std::vector<value_type> m_recv;
+  std::vector<int> m_send_counts, m_send_displs;
+  std::vector<int> m_recv_counts, m_recv_displs;
+};
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_SCATTERVIEW_HPP
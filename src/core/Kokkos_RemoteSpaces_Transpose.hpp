@@ -0,0 +1,215 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_TRANSPOSE_HPP
+#define KOKKOS_REMOTESPACES_TRANSPOSE_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <climits>
+#include <cstring>
+#include <vector>
+
+/* Edge of the square tiles transposed while packing */
+#ifndef KRS_TRANSPOSE_TILE
+#define KRS_TRANSPOSE_TILE 32
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+/* A remote view seen as a matrix distributed by rows: PE p owns the global
+ * rows [p * rows, (p + 1) * rows). Rank-2 global views own R0_size rows per
+ * PE, rank-2 partitioned views one row, and rank-3 partitioned views
+ * (PE, row, column) extent(1) rows. */
+template <class ViewType>
+struct RemoteSpaces_RowDistribution {
+  static constexpr bool is_partitioned =
+      Kokkos::Experimental::Is_Partitioned_Layout<ViewType>::value;
+  static_assert(ViewType::rank == 2 ||
+                    (ViewType::rank == 3 && is_partitioned),
+                "transpose requires rank-2 views or rank-3 partitioned views");
+
+  static constexpr bool is_row_major =
+      std::is_same<typename ViewType::array_layout,
+                   Kokkos::LayoutRight>::value ||
+      std::is_same<typename ViewType::array_layout,
+                   Kokkos::PartitionedLayoutRight>::value;
+
+  ViewType view;
+  size_t rows;
+  size_t cols;
+
+  explicit RemoteSpaces_RowDistribution(const ViewType &v) : view(v) {
+    if (v.impl_map().remote_view_props.using_local_indexing)
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::RemoteSpaces::transpose: subviews are not "
+          "supported");
+    cols = v.extent(ViewType::rank - 1);
+    if constexpr (ViewType::rank == 3)
+      rows = v.extent(1);
+    else if constexpr (is_partitioned)
+      rows = 1;
+    else
+      rows = v.impl_map().get_R0_size();
+  }
+
+  // Local offset of global row row0 + r, column c on the owning PE
+  size_t offset(const size_t r, const size_t c) const {
+    const auto &o = view.impl_map().m_offset;
+    if constexpr (ViewType::rank == 3)
+      return o(0, r, c);
+    else if constexpr (is_partitioned)
+      return o(0, c);
+    else
+      return o(r, c);
+  }
+
+  // Global rows of PE pe below limit
+  Kokkos::pair<size_t, size_t> rows_of(const int pe, const size_t limit) const {
+    const size_t first = pe * rows < limit ? pe * rows : limit;
+    const size_t last  = (pe + 1) * rows < limit ? (pe + 1) * rows : limit;
+    return Kokkos::pair<size_t, size_t>(first, last);
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Collective transpose dst(j, i) = src(i, j) of two row-distributed
+ * remote views.
+ *
+ * Rank-2 views are matrices distributed over dim0; rank-3 partitioned
+ * views (PE, row, column) hold a block of rows per PE, so the transpose of
+ * a (P, m, n) view is a (P, n / P, P * m) view. Global layouts are padded to
+ * a multiple of the PE count: source rows beyond the column count of dst
+ * and dst rows beyond the column count of src are padding and left alone.
+ * Every PE packs one tile per destination PE, transposing it in
+ * KRS_TRANSPOSE_TILE blocks, and the tiles are exchanged with a single
+ * MPI_Alltoallv.
+ */
+template <class DstType, class SrcType>
+void transpose(const DstType &dst, const SrcType &src) {
+  static_assert(Is_View_Of_Type_RemoteSpaces<DstType>::value &&
+                    Is_View_Of_Type_RemoteSpaces<SrcType>::value,
+                "transpose requires remote views");
+  static_assert(std::is_same<typename DstType::value_type,
+                             typename SrcType::non_const_value_type>::value,
+                "transpose requires a non-const destination view of the "
+                "source value type");
+
+  using value_type = typename DstType::non_const_value_type;
+
+  const Kokkos::Impl::RemoteSpaces_RowDistribution<SrcType> a(src);
+  const Kokkos::Impl::RemoteSpaces_RowDistribution<DstType> b(dst);
+
+  int my_pe, num_pes;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_pe);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_pes);
+
+  // Logical extents of the source matrix: b.cols rows, a.cols columns
+  if (b.cols > a.rows * num_pes || a.cols > b.rows * num_pes)
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::RemoteSpaces::transpose: extents of dst do "
+        "not match the transposed extents of src");
+
+  Kokkos::fence();
+  SrcType::memory_space::fence();
+
+  // Tile exchanged from PE p to PE q: source rows of p times source
+  // columns (dst rows) of q, stored column by column
+  auto tile_bytes = [&](const int p, const int q) {
+    auto i = a.rows_of(p, b.cols);
+    auto j = b.rows_of(q, a.cols);
+    return (i.second - i.first) * (j.second - j.first) * sizeof(value_type);
+  };
+
+  std::vector<int> send_counts(num_pes), send_displs(num_pes);
+  std::vector<int> recv_counts(num_pes), recv_displs(num_pes);
+  size_t send_total = 0, recv_total = 0;
+  for (int pe = 0; pe < num_pes; ++pe) {
+    const size_t s_bytes = tile_bytes(my_pe, pe);
+    const size_t r_bytes = tile_bytes(pe, my_pe);
+    if (send_total + s_bytes > INT_MAX || recv_total + r_bytes > INT_MAX)
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::RemoteSpaces::transpose: partition exceeds "
+          "2GB");
+    send_counts[pe] = s_bytes;
+    send_displs[pe] = send_total;
+    recv_counts[pe] = r_bytes;
+    recv_displs[pe] = recv_total;
+    send_total += s_bytes;
+    recv_total += r_bytes;
+  }
+
+  std::vector<value_type> send_buf(send_total / sizeof(value_type));
+  std::vector<value_type> recv_buf(recv_total / sizeof(value_type));
+
+  constexpr size_t T   = KRS_TRANSPOSE_TILE;
+  const value_type *in = src.data();
+  const auto i_mine    = a.rows_of(my_pe, b.cols);
+  for (int pe = 0; pe < num_pes; ++pe) {
+    const auto j_pe = b.rows_of(pe, a.cols);
+    const size_t ni = i_mine.second - i_mine.first;
+    value_type *out = send_buf.data() + send_displs[pe] / sizeof(value_type);
+    for (size_t jj = j_pe.first; jj < j_pe.second; jj += T)
+      for (size_t ii = i_mine.first; ii < i_mine.second; ii += T) {
+        const size_t j_end = jj + T < j_pe.second ? jj + T : j_pe.second;
+        const size_t i_end = ii + T < i_mine.second ? ii + T : i_mine.second;
+        for (size_t i = ii; i < i_end; ++i)
+          for (size_t j = jj; j < j_end; ++j)
+            out[(j - j_pe.first) * ni + (i - i_mine.first)] =
+                in[a.offset(i - i_mine.first, j)];
+      }
+  }
+
+  MPI_Alltoallv(send_buf.data(), send_counts.data(), send_displs.data(),
+                MPI_BYTE, recv_buf.data(), recv_counts.data(),
+                recv_displs.data(), MPI_BYTE, MPI_COMM_WORLD);
+
+  // Each tile column is a contiguous segment of one dst row
+  value_type *res   = dst.data();
+  const auto j_mine = b.rows_of(my_pe, a.cols);
+  for (int pe = 0; pe < num_pes; ++pe) {
+    const auto i_pe = a.rows_of(pe, b.cols);
+    const size_t ni = i_pe.second - i_pe.first;
+    const value_type *tile =
+        recv_buf.data() + recv_displs[pe] / sizeof(value_type);
+    for (size_t j = j_mine.first; j < j_mine.second; ++j) {
+      const value_type *seg = tile + (j - j_mine.first) * ni;
+      const size_t r        = j - j_mine.first;
+      if (b.is_row_major) {
+        if (ni > 0)
+          std::memcpy(res + b.offset(r, i_pe.first), seg,
+                      ni * sizeof(value_type));
+      } else {
+        for (size_t i = 0; i < ni; ++i)
+          res[b.offset(r, i_pe.first + i)] = seg[i];
+      }
+    }
+  }
+
+  DstType::memory_space::fence();
+}
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_TRANSPOSE_HPP
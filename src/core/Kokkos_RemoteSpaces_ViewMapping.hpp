@@ -395,6 +395,29 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION
   int get_PE() const { return remote_view_props.my_PE; }
 
+  // Block size in dim0 known at compile time if the PE count (KRS_NUM_PES)
+  // and the extent of dim0 are static, otherwise zero
+  static constexpr size_t static_R0_size =
+      (RemoteSpaces_StaticNumPEs > 0 && Traits::rank > 0 &&
+       Traits::dimension::rank_dynamic == 0)
+          ? (Traits::dimension::ArgN0 + RemoteSpaces_StaticNumPEs - 1) /
+                RemoteSpaces_StaticNumPEs
+          : 0;
+
+  KOKKOS_INLINE_FUNCTION constexpr bool is_single_PE() const {
+    if constexpr (RemoteSpaces_StaticNumPEs > 0)
+      return RemoteSpaces_StaticNumPEs == 1;
+    else
+      return remote_view_props.num_PEs <= 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_t get_R0_size() const {
+    if constexpr (static_R0_size > 0)
+      return static_R0_size;
+    else
+      return remote_view_props.R0_size;
+  }
+
   KOKKOS_INLINE_FUNCTION
   auto get_ptr() const {
     if (remote_view_props.using_local_indexing)
@@ -432,7 +455,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION constexpr size_t dimension_0(
       ENABLE_IF_GLOBAL_LAYOUT(T)) const {
     if (USING_GLOBAL_INDEXING)
-      return remote_view_props.R0_size;
+      return get_R0_size();
     else
       return m_offset.dimension_0();
   }
@@ -674,8 +697,8 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   template <typename I0>
   KOKKOS_INLINE_FUNCTION Dim0_IndexOffset<I0> compute_dim0_offsets(
       const I0 &_i0) const {
-    assert(remote_view_props.R0_size);
-    auto local_size = static_cast<I0>(remote_view_props.R0_size);
+    assert(get_R0_size());
+    auto local_size = static_cast<I0>(get_R0_size());
     auto target_pe  = static_cast<int>(_i0 / local_size);
     auto dim0_mod   = static_cast<I0>(_i0 % local_size);
     return {target_pe, dim0_mod};
@@ -684,7 +707,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   template <typename I0, typename T = Traits>
   KOKKOS_INLINE_FUNCTION const reference_type
   reference(const I0 &i0, ENABLE_IF_GLOBAL_LAYOUT(T)) const {
-    if (remote_view_props.num_PEs <= 1) {
+    if (is_single_PE()) {
       const reference_type element = m_handle(0, m_offset(i0));
       return element;
     }
@@ -706,7 +729,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   template <typename I0, typename I1, typename T = Traits>
   KOKKOS_INLINE_FUNCTION const reference_type
   reference(const I0 &i0, const I1 &i1, ENABLE_IF_GLOBAL_LAYOUT(T)) const {
-    if (remote_view_props.num_PEs <= 1) {
+    if (is_single_PE()) {
       const reference_type element = m_handle(0, m_offset(i0, i1));
       return element;
     }
@@ -728,7 +751,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const reference_type
   reference(const I0 &i0, const I1 &i1, const I2 &i2,
             ENABLE_IF_GLOBAL_LAYOUT(T)) const {
-    if (remote_view_props.num_PEs <= 1) {
+    if (is_single_PE()) {
       I0 offset                    = m_offset(i0, i1, i2);
       const reference_type element = m_handle(0, offset);
       return element;
@@ -754,7 +777,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const reference_type
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             ENABLE_IF_GLOBAL_LAYOUT(T)) const {
-    if (remote_view_props.num_PEs <= 1) {
+    if (is_single_PE()) {
       const reference_type element = m_handle(0, m_offset(i0, i1, i2, i3));
       return element;
     }
@@ -779,7 +802,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const reference_type
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, ENABLE_IF_GLOBAL_LAYOUT(T)) const {
-    if (remote_view_props.num_PEs <= 1) {
+    if (is_single_PE()) {
       const reference_type element = m_handle(0, m_offset(i0, i1, i2, i3, i4));
       return element;
     }
@@ -804,7 +827,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const reference_type
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, const I5 &i5, ENABLE_IF_GLOBAL_LAYOUT(T)) const {
-    if (remote_view_props.num_PEs <= 1) {
+    if (is_single_PE()) {
       const reference_type element =
           m_handle(0, m_offset(i0, i1, i2, i3, i4, i5));
       return element;
@@ -830,7 +853,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const reference_type reference(
       const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3, const I4 &i4,
       const I5 &i5, const I6 &i6, ENABLE_IF_GLOBAL_LAYOUT(T)) const {
-    if (remote_view_props.num_PEs <= 1) {
+    if (is_single_PE()) {
       const reference_type element =
           m_handle(0, m_offset(i0, i1, i2, i3, i4, i5, i6));
       return element;
@@ -857,7 +880,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, const I5 &i5, const I6 &i6, const I7 &i7,
             ENABLE_IF_GLOBAL_LAYOUT(T)) const {
-    if (remote_view_props.num_PEs <= 1) {
+    if (is_single_PE()) {
       const reference_type element =
           m_handle(0, m_offset(i0, i1, i2, i3, i4, i5, i6, i7));
       return element;
@@ -890,6 +913,16 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
            ~size_t(MemorySpanMask);
   }
 
+  /**\brief  Span, in bytes, of a padded per-PE block */
+  KOKKOS_INLINE_FUNCTION
+  static constexpr size_t padded_memory_span(const size_t span) {
+    const size_t bytes = span * MemorySpanSize;
+    const size_t align = bytes > size_t(RemoteSpaces_PageAlignment)
+                             ? size_t(RemoteSpaces_PageAlignment)
+                             : size_t(RemoteSpaces_LineAlignment);
+    return (bytes + align - 1) & ~(align - 1);
+  }
+
   /**\brief  Span, in bytes, of the required memory */
   KOKKOS_INLINE_FUNCTION
   static constexpr size_t memory_span(
@@ -966,8 +999,11 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
              RemoteSpaces_View_Properties<typename T::size_type> &view_props) {
     for (int i = 0; i < T::rank; i++)
       layout.dimension[i] = arg_layout.dimension[i];
-    view_props.R0_size =
-        Kokkos::Experimental::get_indexing_block_size(arg_layout.dimension[0]);
+    if constexpr (static_R0_size > 0)
+      view_props.R0_size = static_R0_size;
+    else
+      view_props.R0_size = Kokkos::Experimental::get_indexing_block_size(
+          arg_layout.dimension[0]);
     layout.dimension[0] = view_props.R0_size;
   }
 
@@ -1007,6 +1043,14 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
     using record_type =
         Kokkos::Impl::SharedAllocationRecord<memory_space, functor_type>;
 
+    if constexpr (RemoteSpaces_StaticNumPEs > 0) {
+      if (static_cast<int>(Kokkos::Experimental::get_num_pes()) !=
+          RemoteSpaces_StaticNumPEs)
+        Kokkos::abort(
+            "Kokkos Remote Spaces was configured with a static number of PEs "
+            "(KRS_NUM_PES) that does not match the number of running PEs.");
+    }
+
     // Copy layout properties
     typename T::array_layout layout;
     set_layout(arg_layout, layout, remote_view_props);
@@ -1020,9 +1064,12 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
 
     m_offset = offset_type(padding(), layout);
 
+    // Padded views round each PE's block up to a line or page multiple
     const size_t alloc_size =
-        (m_offset.span() * MemorySpanSize + MemorySpanMask) &
-        ~size_t(MemorySpanMask);
+        alloc_prop::allow_padding
+            ? padded_memory_span(m_offset.span())
+            : (m_offset.span() * MemorySpanSize + MemorySpanMask) &
+                  ~size_t(MemorySpanMask);
     const std::string &alloc_name =
         Impl::get_property<Impl::LabelTag>(arg_prop);
     const execution_space &exec_space =
@@ -1041,7 +1088,12 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
 #ifdef KRS_ENABLE_MPISPACE
     if (alloc_size) {
       m_handle = handle_type(reinterpret_cast<pointer_type>(record->data()),
-                             record->win);
+                             record->win, 0, record->state);
+    }
+#elif defined(KRS_ENABLE_RACERLIB)
+    if (alloc_size) {
+      m_handle = handle_type(reinterpret_cast<pointer_type>(record->data()),
+                             record->racerlib_segment);
     }
 #else
     if (alloc_size) {
@@ -1201,7 +1253,8 @@ class ViewMapping<DstTraits, SrcTraits,
             "View Assignment: trying to assign runtime dimension to non "
             "matching compile time dimension.");
     }
-    dst.m_offset = dst_offset_type(src.m_offset);
+    dst.m_offset          = dst_offset_type(src.m_offset);
+    dst.remote_view_props = src.remote_view_props;
     dst.m_handle = Kokkos::Impl::ViewDataHandle<DstTraits>::assign(src.m_handle,
                                                                    src_track);
   }
@@ -0,0 +1,144 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef KOKKOS_REMOTESPACES_WRITECOMBINING_HPP
+#define KOKKOS_REMOTESPACES_WRITECOMBINING_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+/* Bytes buffered per destination before a run is written out */
+#ifndef KRS_WRITE_COMBINING_BYTES
+#define KRS_WRITE_COMBINING_BYTES 4096
+#endif
+
+/* Number of destinations buffered concurrently by each thread */
+#ifndef KRS_WRITE_COMBINING_RUNS
+#define KRS_WRITE_COMBINING_RUNS 8
+#endif
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+/* A contiguous run of stores to one segment (allocation) on one PE */
+struct RemoteSpaces_WCRun {
+  using flush_type = void (*)(const RemoteSpaces_WCRun &);
+
+  int pe              = -1;
+  int64_t segment     = 0;
+  size_t start        = 0;
+  size_t nbytes       = 0;
+  flush_type flush_fn = nullptr;
+  char data[KRS_WRITE_COMBINING_BYTES];
+
+  void flush() {
+    if (nbytes) flush_fn(*this);
+    nbytes = 0;
+  }
+};
+
+/* Per-thread write-combining buffers for fine-grained remote stores.
+ *
+ * Stores that extend the open run of their destination are appended to
+ * it; a store that breaks the run, or does not fit, writes the run out
+ * as one block put through the backend flush function. Reads and
+ * read-modify-writes of a thread write out its run overlapping the
+ * element first. Runs of all threads are written out by flush_all, which
+ * the backends call at fence and before freeing an allocation, while no
+ * kernel is running. */
+class RemoteSpaces_WriteCombiner {
+ public:
+  static void put(int pe, int64_t segment, size_t offset, const void *src,
+                  size_t nbytes, RemoteSpaces_WCRun::flush_type flush_fn) {
+    assert(nbytes <= KRS_WRITE_COMBINING_BYTES);
+    RemoteSpaces_WCRun &run = local().runs[pe % KRS_WRITE_COMBINING_RUNS];
+    if (run.nbytes &&
+        (run.pe != pe || run.segment != segment ||
+         run.start + run.nbytes != offset ||
+         run.nbytes + nbytes > KRS_WRITE_COMBINING_BYTES))
+      run.flush();
+    if (run.nbytes == 0) {
+      run.pe       = pe;
+      run.segment  = segment;
+      run.start    = offset;
+      run.flush_fn = flush_fn;
+    }
+    std::memcpy(run.data + run.nbytes, src, nbytes);
+    run.nbytes += nbytes;
+  }
+
+  /* Writes out the calling thread's run if it overlaps nbytes at offset of
+   * segment on pe. Returns whether a run was written out. */
+  static bool flush(int pe, int64_t segment, size_t offset, size_t nbytes) {
+    RemoteSpaces_WCRun &run = local().runs[pe % KRS_WRITE_COMBINING_RUNS];
+    if (run.nbytes == 0 || run.pe != pe || run.segment != segment ||
+        offset >= run.start + run.nbytes || run.start >= offset + nbytes)
+      return false;
+    run.flush();
+    return true;
+  }
+
+  static void flush_all() {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    for (auto *buffers : registry())
+      for (auto &run : buffers->runs) run.flush();
+  }
+
+ private:
+  struct ThreadBuffers {
+    RemoteSpaces_WCRun runs[KRS_WRITE_COMBINING_RUNS];
+
+    ThreadBuffers() {
+      std::lock_guard<std::mutex> lock(registry_mutex());
+      registry().push_back(this);
+    }
+
+    ~ThreadBuffers() {
+      std::lock_guard<std::mutex> lock(registry_mutex());
+      for (auto &run : runs) run.flush();
+      auto &threads = registry();
+      threads.erase(std::find(threads.begin(), threads.end(), this));
+    }
+  };
+
+  static ThreadBuffers &local() {
+    thread_local ThreadBuffers buffers;
+    return buffers;
+  }
+
+  static std::vector<ThreadBuffers *> &registry() {
+    static std::vector<ThreadBuffers *> threads;
+    return threads;
+  }
+
+  static std::mutex &registry_mutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_WRITECOMBINING_HPP
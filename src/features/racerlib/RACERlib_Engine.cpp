@@ -0,0 +1,287 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <RACERlib_Engine.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RACERlib {
+
+/* Attempts of a waiting reader before it sends pending requests, and
+ * before it bypasses the cache */
+#define RACERLIB_SPINS_PER_PROGRESS 32
+#define RACERLIB_MAX_ATTEMPTS 4096
+
+Engine &Engine::instance() {
+  static Engine engine;
+  return engine;
+}
+
+Engine::Engine()
+    : m_cache(KRS_RACERLIB_CACHE_LINES, KRS_RACERLIB_LINE_BYTES),
+      m_tag_counter(0),
+      m_comm(MPI_COMM_NULL),
+      m_tag_ub(0),
+      m_my_pe(-1),
+      m_num_pes(0),
+      m_initialized(false),
+      m_threaded(false) {}
+
+void Engine::initialize() {
+  int provided;
+  MPI_Query_thread(&provided);
+  m_threaded = provided >= MPI_THREAD_MULTIPLE;
+
+  MPI_Comm_dup(MPI_COMM_WORLD, &m_comm);
+  MPI_Comm_rank(m_comm, &m_my_pe);
+  MPI_Comm_size(m_comm, &m_num_pes);
+
+  int *tag_ub, flag;
+  MPI_Comm_get_attr(m_comm, MPI_TAG_UB, &tag_ub, &flag);
+  m_tag_ub = flag ? *tag_ub : 32767;
+
+  m_queues.reset(new Queue[m_num_pes]);
+  m_initialized = true;
+
+  if (m_threaded) m_worker = std::thread(&Engine::serve, this);
+  Kokkos::push_finalize_hook([]() { Engine::instance().finalize(); });
+}
+
+void Engine::finalize() {
+  if (!m_initialized) return;
+  fence();
+  if (m_threaded) {
+    // Other PEs may still be reading through our worker
+    MPI_Barrier(m_comm);
+    uint64_t stop[2] = {stop_tag, 0};
+    MPI_Send(stop, 2, MPI_UINT64_T, m_my_pe, request_tag, m_comm);
+    m_worker.join();
+  }
+  MPI_Comm_free(&m_comm);
+  m_initialized = false;
+}
+
+int Engine::register_segment(void *base, size_t size) {
+  std::lock_guard<std::mutex> lock(m_segments_mutex);
+  if (!m_initialized) initialize();
+  for (int i = 0; i < KRS_RACERLIB_MAX_SEGMENTS; ++i) {
+    Segment &segment = m_segments[i];
+    if (segment.base.load(std::memory_order_relaxed) == nullptr) {
+      segment.size = size;
+      segment.base.store(static_cast<char *>(base), std::memory_order_release);
+      return i;
+    }
+  }
+  Kokkos::abort(
+      "RACERlib: too many live allocations, increase "
+      "KRS_RACERLIB_MAX_SEGMENTS");
+  return -1;
+}
+
+void Engine::deregister_segment(void *base) {
+  std::lock_guard<std::mutex> lock(m_segments_mutex);
+  for (int i = 0; i < KRS_RACERLIB_MAX_SEGMENTS; ++i) {
+    Segment &segment = m_segments[i];
+    if (segment.base.load(std::memory_order_relaxed) == base) {
+      segment.base.store(nullptr, std::memory_order_release);
+      return;
+    }
+  }
+}
+
+void Engine::get(void *dst, int pe, int segment, size_t offset,
+                 size_t nbytes) {
+  if (pe == m_my_pe) {
+    std::memcpy(dst, m_segments[segment].base.load(std::memory_order_acquire) +
+                         offset,
+                nbytes);
+    return;
+  }
+
+  const size_t line_bytes = m_cache.line_bytes();
+  const LineKey key{pe, segment, offset / line_bytes};
+  const size_t line_offset = offset % line_bytes;
+
+  for (int attempt = 1; attempt <= RACERLIB_MAX_ATTEMPTS; ++attempt) {
+    Cache::Lookup result = m_cache.read(key, line_offset, nbytes, dst);
+    if (result == Cache::Lookup::Hit) return;
+
+    size_t slot;
+    if (result == Cache::Lookup::Miss && m_cache.claim(key, slot)) {
+      enqueue(pe, {segment, key.line, slot, nullptr, 0, 0});
+      continue;
+    }
+    if (attempt % RACERLIB_SPINS_PER_PROGRESS == 0) progress();
+  }
+
+  // The slot keeps being taken by other lines, read around the cache
+  fetch(pe, {{segment, key.line, no_slot, static_cast<char *>(dst),
+              line_offset, nbytes}});
+}
+
+void Engine::enqueue(int pe, const Request &request) {
+  Queue &queue = m_queues[pe];
+  std::vector<Request> batch;
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.requests.push_back(request);
+    if (queue.requests.size() < KRS_RACERLIB_BATCH_SIZE) return;
+    batch.swap(queue.requests);
+  }
+  fetch(pe, batch);
+}
+
+void Engine::flush(int pe) {
+  Queue &queue = m_queues[pe];
+  std::vector<Request> batch;
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    batch.swap(queue.requests);
+  }
+  if (!batch.empty()) fetch(pe, batch);
+}
+
+void Engine::progress() {
+  if (!m_initialized) return;
+  for (int pe = 0; pe < m_num_pes; ++pe)
+    if (pe != m_my_pe) flush(pe);
+  if (!m_threaded)
+    while (serve_one(false))
+      ;
+}
+
+int Engine::next_reply_tag() {
+  const uint64_t n = m_tag_counter.fetch_add(1, std::memory_order_relaxed);
+  return first_reply_tag + int(n % uint64_t(m_tag_ub - first_reply_tag));
+}
+
+/* Sends one aggregated request to pe and distributes the reply */
+void Engine::fetch(int pe, const std::vector<Request> &batch) {
+  const size_t line_bytes = m_cache.line_bytes();
+  const size_t n          = batch.size();
+  const int tag           = next_reply_tag();
+
+  std::vector<uint64_t> msg(2 + 2 * n);
+  msg[0] = tag;
+  msg[1] = n;
+  for (size_t k = 0; k < n; ++k) {
+    msg[2 + 2 * k] = batch[k].segment;
+    msg[3 + 2 * k] = batch[k].line;
+  }
+  std::vector<char> reply(n * line_bytes);
+
+  MPI_Request requests[2];
+  MPI_Irecv(reply.data(), int(reply.size()), MPI_BYTE, pe, tag, m_comm,
+            &requests[0]);
+  MPI_Isend(msg.data(), int(msg.size()), MPI_UINT64_T, pe, request_tag,
+            m_comm, &requests[1]);
+  if (m_threaded) {
+    MPI_Waitall(2, requests, MPI_STATUSES_IGNORE);
+  } else {
+    // Keep serving others while waiting, they may be waiting on us
+    int done = 0;
+    while (!done) {
+      serve_one(false);
+      MPI_Testall(2, requests, &done, MPI_STATUSES_IGNORE);
+    }
+  }
+
+  for (size_t k = 0; k < n; ++k) {
+    const Request &request = batch[k];
+    const char *line       = reply.data() + k * line_bytes;
+    if (request.slot != no_slot)
+      m_cache.fill(request.slot, line);
+    else
+      std::memcpy(request.dst, line + request.offset, request.nbytes);
+  }
+}
+
+/* Owner side: packs the requested lines of a batch into one reply */
+bool Engine::serve_one(bool blocking) {
+  MPI_Message message;
+  MPI_Status status;
+  if (blocking) {
+    MPI_Mprobe(MPI_ANY_SOURCE, request_tag, m_comm, &message, &status);
+  } else {
+    int flag;
+    MPI_Improbe(MPI_ANY_SOURCE, request_tag, m_comm, &flag, &message,
+                &status);
+    if (!flag) return false;
+  }
+
+  int count;
+  MPI_Get_count(&status, MPI_UINT64_T, &count);
+  std::vector<uint64_t> msg(count);
+  MPI_Mrecv(msg.data(), count, MPI_UINT64_T, &message, MPI_STATUS_IGNORE);
+  if (msg[0] == stop_tag) return false;
+
+  const size_t line_bytes = m_cache.line_bytes();
+  const size_t n          = msg[1];
+  std::vector<char> reply(n * line_bytes);
+  for (size_t k = 0; k < n; ++k)
+    copy_line(int(msg[2 + 2 * k]), msg[3 + 2 * k],
+              reply.data() + k * line_bytes);
+  MPI_Send(reply.data(), int(reply.size()), MPI_BYTE, status.MPI_SOURCE,
+           int(msg[0]), m_comm);
+  return true;
+}
+
+void Engine::serve() {
+  while (serve_one(true))
+    ;
+}
+
+void Engine::copy_line(int segment, uint64_t line, char *dst) const {
+  const size_t line_bytes = m_cache.line_bytes();
+  const Segment &seg      = m_segments[segment];
+  const char *base        = seg.base.load(std::memory_order_acquire);
+  const size_t begin      = line * line_bytes;
+  size_t n                = 0;
+  if (base != nullptr && begin < seg.size) {
+    n = std::min(line_bytes, seg.size - begin);
+    std::memcpy(dst, base + begin, n);
+  }
+  std::memset(dst + n, 0, line_bytes - n);
+}
+
+void Engine::fence() {
+  if (!m_initialized) return;
+  progress();
+  if (!m_threaded) {
+    // Serve late requests until every PE has reached the fence
+    MPI_Request barrier;
+    MPI_Ibarrier(m_comm, &barrier);
+    int done = 0;
+    while (!done) {
+      serve_one(false);
+      MPI_Test(&barrier, &done, MPI_STATUS_IGNORE);
+    }
+  }
+  m_cache.invalidate();
+}
+
+#undef RACERLIB_SPINS_PER_PROGRESS
+#undef RACERLIB_MAX_ATTEMPTS
+
+}  // namespace RACERlib
+}  // namespace Experimental
+}  // namespace Kokkos
@@ -0,0 +1,148 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef RACERLIB_ENGINE_HPP
+#define RACERLIB_ENGINE_HPP
+
+#include <Kokkos_RemoteSpaces_LineCache.hpp>
+
+#include <mpi.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Bytes per cache line and unit of transfer */
+#ifndef KRS_RACERLIB_LINE_BYTES
+#define KRS_RACERLIB_LINE_BYTES 512
+#endif
+
+/* Number of lines in the (per-process) software cache */
+#ifndef KRS_RACERLIB_CACHE_LINES
+#define KRS_RACERLIB_CACHE_LINES 16384
+#endif
+
+/* Number of line requests aggregated per PE before they are sent */
+#ifndef KRS_RACERLIB_BATCH_SIZE
+#define KRS_RACERLIB_BATCH_SIZE 64
+#endif
+
+/* Maximum number of live symmetric allocations */
+#ifndef KRS_RACERLIB_MAX_SEGMENTS
+#define KRS_RACERLIB_MAX_SEGMENTS 1024
+#endif
+
+namespace Kokkos {
+namespace Experimental {
+namespace RACERlib {
+
+using Cache   = Kokkos::Experimental::Impl::RemoteSpaces_LineCache;
+using LineKey = Kokkos::Experimental::Impl::RemoteSpaces_LineKey;
+
+/* A symmetric allocation known to the engine. Segment ids are assigned in
+ * allocation order and reused lowest-first, so they agree on all PEs. */
+struct Segment {
+  std::atomic<char *> base{nullptr};
+  size_t size = 0;
+};
+
+/* Remote-access caching and aggregation engine.
+ *
+ * Reads of remote elements are served from a software cache. Misses are
+ * queued per target PE and sent as one request once KRS_RACERLIB_BATCH_SIZE
+ * lines are pending, or when a waiting reader runs out of patience. The
+ * owner packs all requested lines into a single reply. With
+ * MPI_THREAD_MULTIPLE a worker thread serves requests; otherwise they are
+ * served while the process waits for data or in fence. */
+class Engine {
+ public:
+  static Engine &instance();
+
+  int register_segment(void *base, size_t size);
+  void deregister_segment(void *base);
+
+  char *segment_base(int segment) const {
+    return m_segments[segment].base.load(std::memory_order_acquire);
+  }
+
+  int my_pe() const { return m_my_pe; }
+
+  /* Reads nbytes at offset of segment on pe. The range must not cross a
+   * line boundary. */
+  void get(void *dst, int pe, int segment, size_t offset, size_t nbytes);
+
+  /* Sends all pending requests and serves incoming ones */
+  void progress();
+
+  /* Completes outstanding requests of all PEs and invalidates the cache */
+  void fence();
+
+  void finalize();
+
+ private:
+  struct Request {
+    int segment;
+    uint64_t line;
+    size_t slot;  // cache slot, or no_slot for reads bypassing the cache
+    char *dst;
+    size_t offset;
+    size_t nbytes;
+  };
+
+  struct Queue {
+    std::mutex mutex;
+    std::vector<Request> requests;
+  };
+
+  enum : int { stop_tag = 0, request_tag = 1, first_reply_tag = 2 };
+  static constexpr size_t no_slot = ~size_t(0);
+
+  Engine();
+  Engine(const Engine &) = delete;
+  Engine &operator=(const Engine &) = delete;
+
+  void initialize();
+  void enqueue(int pe, const Request &request);
+  void flush(int pe);
+  void fetch(int pe, const std::vector<Request> &batch);
+  void serve();
+  bool serve_one(bool blocking);
+  void copy_line(int segment, uint64_t line, char *dst) const;
+  int next_reply_tag();
+
+  Cache m_cache;
+  Segment m_segments[KRS_RACERLIB_MAX_SEGMENTS];
+  std::mutex m_segments_mutex;
+  std::unique_ptr<Queue[]> m_queues;
+  std::thread m_worker;
+  std::atomic<uint64_t> m_tag_counter;
+  MPI_Comm m_comm;
+  int m_tag_ub;
+  int m_my_pe;
+  int m_num_pes;
+  bool m_initialized;
+  bool m_threaded;
+};
+
+}  // namespace RACERlib
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // RACERLIB_ENGINE_HPP
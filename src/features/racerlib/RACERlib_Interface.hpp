@@ -0,0 +1,65 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#ifndef RACERLIB_INTERFACE_HPP
+#define RACERLIB_INTERFACE_HPP
+
+#include <RACERlib_Engine.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RACERlib {
+
+/* Cached read of the element at byte offset of segment on pe */
+template <class T>
+T get(int segment, int pe, size_t offset) {
+  T val;
+  Engine::instance().get(&val, pe, segment, offset, sizeof(T));
+  return val;
+}
+
+/* Cached read of the element at symmetric address ptr of segment on pe */
+template <class T>
+T get(const T *ptr, int segment, int pe) {
+  Engine &engine = Engine::instance();
+  if (pe == engine.my_pe()) return *ptr;
+  T val;
+  engine.get(&val, pe, segment,
+             reinterpret_cast<const char *>(ptr) - engine.segment_base(segment),
+             sizeof(T));
+  return val;
+}
+
+/* Registers a symmetric allocation and returns its segment. Must be called
+ * in the same order on all PEs. */
+inline int register_allocation(void *ptr, size_t size) {
+  return Engine::instance().register_segment(ptr, size);
+}
+
+inline void deregister_allocation(void *ptr) {
+  Engine::instance().deregister_segment(ptr);
+}
+
+/* Completes outstanding requests and invalidates cached lines */
+inline void fence() { Engine::instance().fence(); }
+
+}  // namespace RACERlib
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // RACERLIB_INTERFACE_HPP
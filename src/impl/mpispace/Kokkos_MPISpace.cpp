@@ -20,17 +20,42 @@
 #include <csignal>
 #include <mpi.h>
 
+#include <algorithm>
 #include <iostream>
 
+#ifdef KRS_ENABLE_READONLY_CACHE
+#include <Kokkos_RemoteSpaces_LineCache.hpp>
+#endif
+#ifdef KRS_ENABLE_WRITE_COMBINING
+#include <Kokkos_RemoteSpaces_WriteCombining.hpp>
+#endif
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+#include <Kokkos_RemoteSpaces_AtomicAggregation.hpp>
+#endif
+
 namespace Kokkos {
 namespace Experimental {
 
 MPI_Win MPISpace::current_win;
 std::vector<MPI_Win> MPISpace::mpi_windows;
+std::vector<Impl::MPIWindowState *> MPISpace::window_states;
+Impl::MPIWindowState *MPISpace::current_state;
 std::mutex internal_mpi_backend_mutex;
 
+#ifdef KRS_ENABLE_READONLY_CACHE
+namespace {
+Impl::RemoteSpaces_LineCache &readonly_cache() {
+  static Impl::RemoteSpaces_LineCache cache(KRS_READONLY_CACHE_LINES,
+                                            KRS_READONLY_CACHE_LINE_BYTES);
+  return cache;
+}
+}  // namespace
+#endif
+
 /* Default allocation mechanism */
-MPISpace::MPISpace() : allocation_mode(Kokkos::Experimental::Symmetric) {}
+MPISpace::MPISpace() : allocation_mode(Kokkos::Experimental::Symmetric) {
+  Impl::initialize_topology();
+}
 
 void MPISpace::impl_set_allocation_mode(const int allocation_mode_) {
   allocation_mode = allocation_mode_;
@@ -68,9 +93,20 @@ void *MPISpace::impl_allocate(
   if (arg_alloc_size) {
     // Over-allocate to and round up to guarantee proper alignment.
     size_t size_padded = arg_alloc_size + sizeof(void *) + alignment;
-    if (allocation_mode == Kokkos::Experimental::Symmetric) {
+    if (allocation_mode == Kokkos::Experimental::Symmetric ||
+        allocation_mode == Kokkos::Experimental::Fenced) {
+      // The window starts at the allocation header, placed so that the
+      // data following it is page aligned if it spans more than a page
+      const size_t data_alignment =
+          Impl::remote_spaces_data_alignment(arg_alloc_size);
+      const size_t header_offset =
+          Impl::remote_spaces_header_offset(data_alignment);
+      const size_t base_size =
+          (header_offset + size_padded + data_alignment - 1) &
+          ~(data_alignment - 1);
       current_win = MPI_WIN_NULL;
-      ptr         = aligned_alloc(Kokkos::Impl::MEMORY_ALIGNMENT, size_padded);
+      ptr         = aligned_alloc(data_alignment, base_size);
+      if (ptr) ptr = static_cast<char *>(ptr) + header_offset;
       MPI_Win_create(ptr, size_padded, 1, MPI_INFO_NULL, MPI_COMM_WORLD,
                      &current_win);
 
@@ -89,13 +125,34 @@ void *MPISpace::impl_allocate(
       assert(ptr != nullptr);
       assert(current_win != MPI_WIN_NULL);
 
-      int ret = MPI_Win_lock_all(MPI_MODE_NOCHECK, current_win);
-      if (ret != MPI_SUCCESS) {
-        Kokkos::abort("MPI window lock all failed.");
+      const bool fenced = allocation_mode == Kokkos::Experimental::Fenced;
+      if (fenced) {
+        // Open the first active-target epoch, closed by MPISpace::fence
+        int ret = MPI_Win_fence(MPI_MODE_NOPRECEDE, current_win);
+        if (ret != MPI_SUCCESS) {
+          Kokkos::abort("MPI window fence failed.");
+        }
+      } else {
+        int ret = MPI_Win_lock_all(MPI_MODE_NOCHECK, current_win);
+        if (ret != MPI_SUCCESS) {
+          Kokkos::abort("MPI window lock all failed.");
+        }
       }
       int i;
 
+      current_state              = new Kokkos::Impl::MPIWindowState;
+      current_state->win         = current_win;
+      current_state->element_win = MPI_WIN_NULL;
+      current_state->mode        = fenced ? Kokkos::Impl::MPIWindowFenced
+                                          : Kokkos::Impl::MPIWindowPassive;
+      if (fenced) Kokkos::Impl::mpi_open_element_window(current_state);
+#ifdef KRS_ENABLE_RACERLIB
+      current_state->racerlib_segment =
+          RACERlib::register_allocation(ptr, size_padded);
+#endif
+
       internal_mpi_backend_mutex.lock();
+      window_states.push_back(current_state);
       for (i = 0; i < mpi_windows.size(); ++i) {
         if (mpi_windows[i] == MPI_WIN_NULL) break;
       }
@@ -105,7 +162,8 @@ void *MPISpace::impl_allocate(
         mpi_windows[i] = current_win;
       internal_mpi_backend_mutex.unlock();
     } else {
-      Kokkos::abort("MPISpace only supports symmetric allocation policy.");
+      Kokkos::abort(
+          "MPISpace only supports symmetric and fenced allocation policies.");
     }
   }
 
@@ -159,6 +217,13 @@ void MPISpace::impl_deallocate(
                                         reported_size);
     }
 
+#ifdef KRS_ENABLE_WRITE_COMBINING
+    Impl::RemoteSpaces_WriteCombiner::flush_all();
+#endif
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+    Impl::RemoteSpaces_AtomicAggregator::flush_all();
+#endif
+
     internal_mpi_backend_mutex.lock();
     int last_valid;
     for (last_valid = 0; last_valid < mpi_windows.size(); ++last_valid) {
@@ -174,8 +239,29 @@ void MPISpace::impl_deallocate(
       }
     }
 
+#ifdef KRS_ENABLE_RACERLIB
+    RACERlib::deregister_allocation(arg_alloc_ptr);
+#endif
+#ifdef KRS_ENABLE_READONLY_CACHE
+    // Window handles may be reused by later allocations
+    readonly_cache().invalidate();
+#endif
+
     assert(current_win != MPI_WIN_NULL);
-    MPI_Win_unlock_all(current_win);
+    for (auto it = window_states.begin(); it != window_states.end(); ++it) {
+      if ((*it)->win != current_win) continue;
+      if ((*it)->mode == Kokkos::Impl::MPIWindowFenced)
+        MPI_Win_fence(MPI_MODE_NOSUCCEED, current_win);
+      else
+        MPI_Win_unlock_all(current_win);
+      if ((*it)->element_win != MPI_WIN_NULL) {
+        MPI_Win_unlock_all((*it)->element_win);
+        MPI_Win_free(&(*it)->element_win);
+      }
+      delete *it;
+      window_states.erase(it);
+      break;
+    }
     MPI_Win_free(&current_win);
 
     if (last_valid != 0)
@@ -187,12 +273,33 @@ void MPISpace::impl_deallocate(
   }
 }
 
-void MPISpace::fence() {
+void MPISpace::fence() { fence(0); }
+
+void MPISpace::fence(const int mpi_assert) {
+#ifdef KRS_ENABLE_RACERLIB
+  RACERlib::fence();
+#endif
+#ifdef KRS_ENABLE_WRITE_COMBINING
+  Impl::RemoteSpaces_WriteCombiner::flush_all();
+#endif
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+  Impl::RemoteSpaces_AtomicAggregator::flush_all();
+#endif
   internal_mpi_backend_mutex.lock();
-  for (int i = 0; i < mpi_windows.size(); i++) {
-    if (mpi_windows[i] != MPI_WIN_NULL) MPI_Win_flush_all(mpi_windows[i]);
+  for (auto *state : window_states) {
+    // Epochs of neighbor-synchronized windows are driven by NeighborSync
+    if (state->mode == Kokkos::Impl::MPIWindowFenced) {
+      MPI_Win_fence(mpi_assert, state->win);
+    } else if (state->mode == Kokkos::Impl::MPIWindowPassive) {
+      MPI_Win_flush_all(state->win);
+    }
+    if (state->element_win != MPI_WIN_NULL)
+      MPI_Win_flush_all(state->element_win);
   }
   internal_mpi_backend_mutex.unlock();
+#ifdef KRS_ENABLE_READONLY_CACHE
+  readonly_cache().invalidate();
+#endif
   MPI_Barrier(MPI_COMM_WORLD);
 }
 
@@ -211,14 +318,186 @@ size_t get_my_pe() {
 
 namespace Impl {
 
+void mpi_open_element_window(MPIWindowState *state) {
+  if (state->element_win != MPI_WIN_NULL) return;
+  char *base;
+  MPI_Aint *size;
+  int flag;
+  MPI_Win_get_attr(state->win, MPI_WIN_BASE, &base, &flag);
+  MPI_Win_get_attr(state->win, MPI_WIN_SIZE, &size, &flag);
+  MPI_Win_create(base, *size, 1, MPI_INFO_NULL, MPI_COMM_WORLD,
+                 &state->element_win);
+  if (MPI_Win_lock_all(MPI_MODE_NOCHECK, state->element_win) != MPI_SUCCESS)
+    Kokkos::abort("MPI window lock all failed.");
+}
+
+// Callers hold internal_mpi_backend_mutex
+static MPIWindowState *mpi_window_state(const MPI_Win &win) {
+  for (auto *state : Kokkos::Experimental::MPISpace::window_states)
+    if (state->win == win) return state;
+  return nullptr;
+}
+
+bool mpi_window_begin_neighbor_sync(const MPI_Win &win) {
+  Kokkos::Experimental::internal_mpi_backend_mutex.lock();
+  MPIWindowState *state = mpi_window_state(win);
+  if (state->mode == MPIWindowNeighbor)
+    Kokkos::abort("MPI window is already synchronized by a NeighborSync.");
+  const bool was_fenced = state->mode == MPIWindowFenced;
+  if (was_fenced) {
+    MPI_Win_fence(MPI_MODE_NOSUCCEED, win);
+  } else {
+    MPI_Win_unlock_all(win);
+    mpi_open_element_window(state);
+  }
+  state->mode = MPIWindowNeighbor;
+  Kokkos::Experimental::internal_mpi_backend_mutex.unlock();
+  return was_fenced;
+}
+
+void mpi_window_end_neighbor_sync(const MPI_Win &win, const bool fenced) {
+  Kokkos::Experimental::internal_mpi_backend_mutex.lock();
+  MPIWindowState *state = mpi_window_state(win);
+  if (fenced) {
+    MPI_Win_fence(MPI_MODE_NOPRECEDE, win);
+    state->mode = MPIWindowFenced;
+  } else {
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+    state->mode = MPIWindowPassive;
+  }
+  Kokkos::Experimental::internal_mpi_backend_mutex.unlock();
+}
+
+#ifdef KRS_ENABLE_READONLY_CACHE
+void mpi_cached_get(void *dst, const MPIAccessLocation &loc, int pe,
+                    size_t offset, size_t nbytes) {
+  const MPI_Win &win = mpi_element_window(loc);
+  auto &cache             = Kokkos::Experimental::readonly_cache();
+  const size_t line_bytes = cache.line_bytes();
+  const size_t line       = offset / line_bytes;
+  const size_t line_start = line * line_bytes;
+
+  if (offset - line_start + nbytes > line_bytes) {
+    // Element straddles two lines
+    MPI_Get(dst, nbytes, MPI_BYTE, pe, offset, nbytes, MPI_BYTE, win);
+    MPI_Win_flush(pe, win);
+    return;
+  }
+
+  // Windows are identified by their handle
+  int64_t segment = 0;
+  memcpy(&segment, &win, std::min(sizeof(win), sizeof(segment)));
+
+  Kokkos::Experimental::Impl::RemoteSpaces_LineKey key{pe, segment, line};
+  cache.get(key, offset - line_start, nbytes, dst, [&](char *buf) {
+    // Windows are symmetric, the local size bounds the last line
+    MPI_Aint *win_size;
+    int flag;
+    MPI_Win_get_attr(win, MPI_WIN_SIZE, &win_size, &flag);
+    size_t count = std::min(line_bytes, size_t(*win_size) - line_start);
+    MPI_Get(buf, count, MPI_BYTE, pe, line_start, count, MPI_BYTE, win);
+    MPI_Win_flush(pe, win);
+  });
+}
+#endif
+
+#ifdef KRS_ENABLE_WRITE_COMBINING
+static void mpi_flush_run(
+    const Kokkos::Experimental::Impl::RemoteSpaces_WCRun &run) {
+  MPI_Win win;
+  memcpy(&win, &run.segment, sizeof(win));
+  MPI_Put(run.data, run.nbytes, MPI_BYTE, run.pe, run.start, run.nbytes,
+          MPI_BYTE, win);
+  MPI_Win_flush_local(run.pe, win);
+}
+
+void mpi_combined_put(const void *src, const MPIAccessLocation &loc, int pe,
+                      size_t offset, size_t nbytes) {
+  const MPI_Win &win = mpi_element_window(loc);
+  static_assert(sizeof(MPI_Win) <= sizeof(int64_t),
+                "MPI_Win handles must fit a write-combining segment id");
+  int64_t segment = 0;
+  memcpy(&segment, &win, sizeof(win));
+  Kokkos::Experimental::Impl::RemoteSpaces_WriteCombiner::put(
+      pe, segment, offset, src, nbytes, mpi_flush_run);
+}
+
+void mpi_combined_flush(const MPIAccessLocation &loc, int pe, size_t offset,
+                        size_t nbytes) {
+  const MPI_Win &win = mpi_element_window(loc);
+  int64_t segment     = 0;
+  memcpy(&segment, &win, sizeof(win));
+  // Puts and gets to the same target are unordered, complete the put
+  if (Kokkos::Experimental::Impl::RemoteSpaces_WriteCombiner::flush(
+          pe, segment, offset, nbytes))
+    MPI_Win_flush(pe, win);
+}
+#endif
+
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+template <class T>
+static void mpi_flush_atomic_batch(
+    const Kokkos::Experimental::Impl::RemoteSpaces_AtomicBatch<T> &batch) {
+  MPI_Win win;
+  memcpy(&win, &batch.segment, sizeof(win));
+  std::vector<MPI_Aint> displs(batch.offsets.begin(),
+                               batch.offsets.begin() + batch.count);
+  mpi_indexed_accumulate(batch.values.data(), displs.data(), batch.count,
+                         batch.pe, win, MPI_SUM);
+  MPI_Win_flush_local(batch.pe, win);
+}
+
+template <class T>
+void mpi_aggregated_flush(const MPIAccessLocation &loc, int pe,
+                          size_t offset) {
+  const MPI_Win &win = mpi_element_window(loc);
+  int64_t segment     = 0;
+  memcpy(&segment, &win, sizeof(win));
+  // Accumulates from one origin to an element are applied in order, the
+  // following atomic operation needs no remote completion
+  Kokkos::Experimental::Impl::RemoteSpaces_AtomicAggregator::flush<T>(
+      pe, segment, offset);
+}
+
+#define KOKKOS_REMOTESPACES_AGGREGATED_ADD(type)                         \
+  void mpi_aggregated_add(const type &val, const MPIAccessLocation &loc, \
+                          int pe, size_t offset) {                       \
+    const MPI_Win &win = mpi_element_window(loc);                        \
+    int64_t segment     = 0;                                             \
+    memcpy(&segment, &win, sizeof(win));                                 \
+    Kokkos::Experimental::Impl::RemoteSpaces_AtomicAggregator::add(      \
+        pe, segment, offset, val, mpi_flush_atomic_batch<type>);         \
+  }                                                                      \
+  template void mpi_aggregated_flush<type>(const MPIAccessLocation &loc, \
+                                           int pe, size_t offset);
+
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(char)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned char)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(short)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned short)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(int)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned int)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(long long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned long long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(float)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(double)
+#undef KOKKOS_REMOTESPACES_AGGREGATED_ADD
+#endif
+
 Kokkos::Impl::DeepCopy<HostSpace, Kokkos::Experimental::MPISpace>::DeepCopy(
     void *dst, const void *src, size_t n) {
-  memcpy(dst, src, n);
+  Kokkos::DefaultHostExecutionSpace exec;
+  remote_spaces_parallel_memcpy(exec, dst, src, n);
+  exec.fence();
 }
 
 Kokkos::Impl::DeepCopy<Kokkos::Experimental::MPISpace, HostSpace>::DeepCopy(
     void *dst, const void *src, size_t n) {
-  memcpy((char *)dst, (char *)src, n);
+  Kokkos::DefaultHostExecutionSpace exec;
+  remote_spaces_parallel_memcpy(exec, dst, src, n);
+  exec.fence();
 }
 
 Kokkos::Impl::DeepCopy<Kokkos::Experimental::MPISpace,
@@ -226,24 +505,9 @@ Kokkos::Impl::DeepCopy<Kokkos::Experimental::MPISpace,
                                                                  const void
                                                                      *src,
                                                                  size_t n) {
-  memcpy(dst, src, n);
-}
-
-template <typename ExecutionSpace>
-Kokkos::Impl::DeepCopy<Kokkos::Experimental::MPISpace,
-                       Kokkos::Experimental::MPISpace,
-                       ExecutionSpace>::DeepCopy(void *dst, const void *src,
-                                                 size_t n) {
-  memcpy(dst, src, n);
-}
-
-template <typename ExecutionSpace>
-Kokkos::Impl::DeepCopy<Kokkos::Experimental::MPISpace,
-                       Kokkos::Experimental::MPISpace,
-                       ExecutionSpace>::DeepCopy(const ExecutionSpace &exec,
-                                                 void *dst, const void *src,
-                                                 size_t n) {
-  memcpy(dst, src, n);
+  Kokkos::DefaultHostExecutionSpace exec;
+  remote_spaces_parallel_memcpy(exec, dst, src, n);
+  exec.fence();
 }
 
 }  // namespace Impl
@@ -25,12 +25,36 @@
 #include <typeinfo>
 
 #include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces_ParallelCopy.hpp>
 
 #include <Kokkos_RemoteSpaces.hpp>
 #include <mpi.h>
+#include <atomic>
 #include <vector>
 
 namespace Kokkos {
+namespace Impl {
+
+/* Epoch model of an MPI window. Windows in the Fenced mode or synchronized
+ * by a NeighborSync are accessed in active-target epochs. */
+enum MPIWindowMode { MPIWindowPassive, MPIWindowFenced, MPIWindowNeighbor };
+
+/* State of an MPI window shared by all views of its allocation. The mode
+ * is changed collectively between kernels and read by element accesses.
+ * Element accesses complete immediately, which active-target epochs do not
+ * allow; they go through element_win, a passive-target window over the
+ * same memory, while win is not in the Passive mode. */
+struct MPIWindowState {
+  MPI_Win win;
+  MPI_Win element_win;
+  std::atomic<int> mode;
+#ifdef KRS_ENABLE_RACERLIB
+  int racerlib_segment;
+#endif
+};
+
+}  // namespace Impl
+
 namespace Experimental {
 
 class MPISpace {
@@ -91,11 +115,18 @@ class MPISpace {
 
   static void fence();
 
+  /**\brief Fence with MPI_Win_fence assertions (MPI_MODE_NOSTORE,
+   * MPI_MODE_NOPUT, MPI_MODE_NOPRECEDE, MPI_MODE_NOSUCCEED) that hold for
+   * all allocations made in the Fenced mode */
+  static void fence(const int mpi_assert);
+
   int allocation_mode;
   int64_t extent;
 
   static std::vector<MPI_Win> mpi_windows;
+  static std::vector<Kokkos::Impl::MPIWindowState *> window_states;
   static MPI_Win current_win;
+  static Kokkos::Impl::MPIWindowState *current_state;
 
   void impl_set_allocation_mode(const int);
   void impl_set_extent(int64_t N);
@@ -118,24 +149,61 @@ namespace Impl {
 template <>
 struct DeepCopy<HostSpace, Kokkos::Experimental::MPISpace> {
   DeepCopy(void *dst, const void *src, size_t);
+  template <class ExecutionSpace>
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
 };
 
 template <>
 struct DeepCopy<Kokkos::Experimental::MPISpace, HostSpace> {
   DeepCopy(void *dst, const void *src, size_t);
+  template <class ExecutionSpace>
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
 };
 
 template <>
 struct DeepCopy<Kokkos::Experimental::MPISpace,
                 Kokkos::Experimental::MPISpace> {
   DeepCopy(void *dst, const void *src, size_t);
+  template <class ExecutionSpace>
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
 };
 
 template <class ExecutionSpace>
-struct DeepCopy<Kokkos::Experimental::MPISpace, Kokkos::Experimental::MPISpace,
-                ExecutionSpace> {
-  DeepCopy(void *dst, const void *src, size_t n);
-  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n);
+struct DeepCopy<HostSpace, Kokkos::Experimental::MPISpace, ExecutionSpace> {
+  DeepCopy(void *dst, const void *src, size_t n) {
+    DeepCopy<HostSpace, Kokkos::Experimental::MPISpace>(dst, src, n);
+  }
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
+};
+
+template <class ExecutionSpace>
+struct DeepCopy<Kokkos::Experimental::MPISpace, HostSpace, ExecutionSpace> {
+  DeepCopy(void *dst, const void *src, size_t n) {
+    DeepCopy<Kokkos::Experimental::MPISpace, HostSpace>(dst, src, n);
+  }
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
+};
+
+template <class ExecutionSpace>
+struct DeepCopy<Kokkos::Experimental::MPISpace,
+                Kokkos::Experimental::MPISpace, ExecutionSpace> {
+  DeepCopy(void *dst, const void *src, size_t n) {
+    using space_t = Kokkos::Experimental::MPISpace;
+    DeepCopy<space_t, space_t>(dst, src, n);
+  }
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
 };
 
 template <>
@@ -164,30 +232,110 @@ struct MemorySpaceAccess<Kokkos::Experimental::MPISpace, Kokkos::HostSpace> {
 typedef struct MPIAccessLocation {
   mutable MPI_Win win;
   size_t offset;
+  MPIWindowState *state;
   KOKKOS_INLINE_FUNCTION
   MPIAccessLocation() {
     win    = MPI_WIN_NULL;
     offset = 0;
+    state  = nullptr;
   }
 
   KOKKOS_INLINE_FUNCTION
-  MPIAccessLocation(MPI_Win win_, size_t offset_) {
+  MPIAccessLocation(MPI_Win win_, size_t offset_,
+                    MPIWindowState *state_ = nullptr) {
     win    = win_;
     offset = offset_;
+    state  = state_;
   }
 
   KOKKOS_INLINE_FUNCTION
   void operator=(const MPIAccessLocation &val) {
     win    = val.win;
     offset = val.offset;
+    state  = val.state;
   }
 } MPIAccessLocation;
 
+/* Windows in active-target epochs complete RMA at the end of the epoch,
+ * flushes and request completion do not apply. */
+inline bool mpi_window_is_fenced(const MPIAccessLocation &loc) {
+  return loc.state != nullptr &&
+         loc.state->mode.load(std::memory_order_relaxed) != MPIWindowPassive;
+}
+
+/* Creates the element window of state, unless it has one. Collective. */
+void mpi_open_element_window(MPIWindowState *state);
+
+/* Moves win to post/start/complete/wait epochs driven by a NeighborSync.
+ * Collective, outstanding RMA must be fenced. Returns whether win was
+ * allocated in the Fenced mode. */
+bool mpi_window_begin_neighbor_sync(const MPI_Win &win);
+
+/* Returns win to the epoch model it had before
+ * mpi_window_begin_neighbor_sync. Collective. */
+void mpi_window_end_neighbor_sync(const MPI_Win &win, const bool fenced);
+
+/* Window for the element accesses of loc */
+inline const MPI_Win &mpi_element_window(const MPIAccessLocation &loc) {
+  return mpi_window_is_fenced(loc) ? loc.state->element_win : loc.win;
+}
+
+#ifdef KRS_ENABLE_READONLY_CACHE
+/* Reads nbytes at byte offset of win on pe through the read-only line
+ * cache. Cached lines are discarded by MPISpace::fence. */
+void mpi_cached_get(void *dst, const MPIAccessLocation &loc, int pe,
+                    size_t offset, size_t nbytes);
+#endif
+
+#ifdef KRS_ENABLE_WRITE_COMBINING
+/* Buffers a store of nbytes at byte offset of win on pe. Contiguous stores
+ * are combined and written out as block puts, at the latest by
+ * MPISpace::fence. */
+void mpi_combined_put(const void *src, const MPIAccessLocation &loc, int pe,
+                      size_t offset, size_t nbytes);
+
+/* Completes the calling thread's buffered stores overlapping nbytes at
+ * byte offset of win on pe, before they are read. */
+void mpi_combined_flush(const MPIAccessLocation &loc, int pe, size_t offset,
+                        size_t nbytes);
+#endif
+
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+/* Buffers an atomic add of val at byte offset of win on pe. Adds to the
+ * same element are merged and applied as indexed accumulates, at the
+ * latest by MPISpace::fence. */
+#define KOKKOS_REMOTESPACES_AGGREGATED_ADD(type)                      \
+  void mpi_aggregated_add(const type &val, const MPIAccessLocation &loc, \
+                          int pe, size_t offset);
+
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(char)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned char)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(short)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned short)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(int)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned int)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(long long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned long long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(float)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(double)
+#undef KOKKOS_REMOTESPACES_AGGREGATED_ADD
+
+/* Issues the calling thread's buffered adds to the element of type T at
+ * byte offset of win on pe, ahead of another atomic operation on it */
+template <class T>
+void mpi_aggregated_flush(const MPIAccessLocation &loc, int pe, size_t offset);
+#endif
+
 }  // namespace Impl
 }  // namespace Kokkos
 
 #include <Kokkos_RemoteSpaces_Error.hpp>
 #include <Kokkos_RemoteSpaces_Options.hpp>
+#ifdef KRS_ENABLE_RACERLIB
+#include <RACERlib_Interface.hpp>
+#endif
 #include <Kokkos_MPISpace_ViewTraits.hpp>
 #include <Kokkos_RemoteSpaces_ViewLayout.hpp>
 #include <Kokkos_RemoteSpaces_Helpers.hpp>
@@ -199,5 +347,19 @@ typedef struct MPIAccessLocation {
 #include <Kokkos_MPISpace_AllocationRecord.hpp>
 #include <Kokkos_MPISpace_DataHandle.hpp>
 #include <Kokkos_RemoteSpaces_LocalDeepCopy.hpp>
+#include <Kokkos_RemoteSpaces_Prefetch.hpp>
+#include <Kokkos_RemoteSpaces_AsyncGet.hpp>
+#include <Kokkos_RemoteSpaces_IndexLists.hpp>
+#include <Kokkos_RemoteSpaces_GatherPlan.hpp>
+#include <Kokkos_RemoteSpaces_GatherScatter.hpp>
+#include <Kokkos_RemoteSpaces_ScatterView.hpp>
+#include <Kokkos_RemoteSpaces_DualView.hpp>
+#include <Kokkos_RemoteSpaces_DeepCopyAsync.hpp>
+#include <Kokkos_RemoteSpaces_Redistribute.hpp>
+#include <Kokkos_RemoteSpaces_RootTransfers.hpp>
+#include <Kokkos_RemoteSpaces_Transpose.hpp>
+#include <Kokkos_RemoteSpaces_CommPlan.hpp>
+#include <Kokkos_RemoteSpaces_GhostedView.hpp>
+#include <Kokkos_RemoteSpaces_NeighborSync.hpp>
 
 #endif  // #define KOKKOS_MPISPACE_HPP
@@ -81,7 +81,8 @@ SharedAllocationRecord<Kokkos::Experimental::MPISpace, void>::
   this->base_t::_fill_host_accessible_header_info(*RecordBase::m_alloc_ptr,
                                                   arg_label);
 #endif
-  win = m_space.current_win;
+  win   = m_space.current_win;
+  state = m_space.current_state;
 }
 
 }  // namespace Impl
@@ -74,7 +74,8 @@ class SharedAllocationRecord<Kokkos::Experimental::MPISpace, void>
     this->base_t::_fill_host_accessible_header_info(*RecordBase::m_alloc_ptr,
                                                     arg_label);
 #endif
-    win = m_space.current_win;
+    win   = m_space.current_win;
+    state = m_space.current_state;
   }
 
   SharedAllocationRecord(
@@ -84,6 +85,7 @@ class SharedAllocationRecord<Kokkos::Experimental::MPISpace, void>
 
  public:
   MPI_Win win;
+  MPIWindowState* state;
 
   KOKKOS_INLINE_FUNCTION static SharedAllocationRecord* allocate(
       const Kokkos::Experimental::MPISpace& arg_space,
@@ -28,12 +28,19 @@ namespace Impl {
 #define KOKKOS_REMOTESPACES_PUT(type, mpi_type)                                \
   static KOKKOS_INLINE_FUNCTION void mpi_block_type_put(                       \
       const type *ptr, const size_t offset, const size_t nelems, const int pe, \
-      const MPI_Win &win) {                                                    \
+      const MPIAccessLocation &loc) {                                          \
+    const MPI_Win &win = loc.win;                                              \
     assert(win != MPI_WIN_NULL);                                               \
     MPI_Request request;                                                       \
     const void *src_adr = ptr;                                                 \
     size_t win_offset =                                                        \
         sizeof(SharedAllocationHeader) + offset * sizeof(type);                \
+    if (mpi_window_is_fenced(loc)) {                                           \
+      /* Completes at MPISpace::fence */                                       \
+      MPI_Put(src_adr, nelems, mpi_type, pe, win_offset, nelems, mpi_type,     \
+              win);                                                            \
+      return;                                                                  \
+    }                                                                          \
     MPI_Rput(src_adr, nelems, mpi_type, pe, win_offset, nelems, mpi_type, win, \
              &request);                                                        \
     MPI_Wait(&request, MPI_STATUS_IGNORE);                                     \
@@ -57,12 +64,19 @@ KOKKOS_REMOTESPACES_PUT(double, MPI_DOUBLE)
 #define KOKKOS_REMOTESPACES_GET(type, mpi_type)                                \
   static KOKKOS_INLINE_FUNCTION void mpi_block_type_get(                       \
       type *ptr, const size_t offset, const size_t nelems, const int pe,       \
-      const MPI_Win &win) {                                                    \
+      const MPIAccessLocation &loc) {                                          \
+    const MPI_Win &win = loc.win;                                              \
     assert(win != MPI_WIN_NULL);                                               \
     MPI_Request request;                                                       \
     void *dst_adr = ptr;                                                       \
     size_t win_offset =                                                        \
         sizeof(SharedAllocationHeader) + offset * sizeof(type);                \
+    if (mpi_window_is_fenced(loc)) {                                           \
+      /* Completes at MPISpace::fence */                                       \
+      MPI_Get(dst_adr, nelems, mpi_type, pe, win_offset, nelems, mpi_type,     \
+              win);                                                            \
+      return;                                                                  \
+    }                                                                          \
     MPI_Rget(dst_adr, nelems, mpi_type, pe, win_offset, nelems, mpi_type, win, \
              &request);                                                        \
     MPI_Wait(&request, MPI_STATUS_IGNORE);                                     \
@@ -83,12 +97,81 @@ KOKKOS_REMOTESPACES_GET(double, MPI_DOUBLE)
 
 #undef KOKKOS_REMOTESPACES_GET
 
+/* Non-blocking block transfers completed by request. On fenced windows the
+ * request is null and the transfer completes at the end of the epoch. */
+static KOKKOS_INLINE_FUNCTION void mpi_block_get_nbi(
+    void *dst, const size_t offset, const size_t nbytes, const int pe,
+    const MPIAccessLocation &loc, MPI_Request *request) {
+  const MPI_Win &win = loc.win;
+  assert(win != MPI_WIN_NULL);
+  if (mpi_window_is_fenced(loc)) {
+    // Request-based RMA needs a passive-target epoch
+    MPI_Get(dst, nbytes, MPI_BYTE, pe, offset, nbytes, MPI_BYTE, win);
+    *request = MPI_REQUEST_NULL;
+    return;
+  }
+  MPI_Rget(dst, nbytes, MPI_BYTE, pe, offset, nbytes, MPI_BYTE, win, request);
+}
+
+static KOKKOS_INLINE_FUNCTION void mpi_block_put_nbi(
+    const void *src, const size_t offset, const size_t nbytes, const int pe,
+    const MPIAccessLocation &loc, MPI_Request *request) {
+  const MPI_Win &win = loc.win;
+  assert(win != MPI_WIN_NULL);
+  if (mpi_window_is_fenced(loc)) {
+    MPI_Put(src, nbytes, MPI_BYTE, pe, offset, nbytes, MPI_BYTE, win);
+    *request = MPI_REQUEST_NULL;
+    return;
+  }
+  MPI_Rput(src, nbytes, MPI_BYTE, pe, offset, nbytes, MPI_BYTE, win, request);
+}
+
+/* Indexed transfers between a packed local buffer and nelems elements at
+ * the byte displacements displs of win on pe. Completion is left to the
+ * caller (MPI_Win_flush_local). Accumulates allow repeated displacements. */
+#define KOKKOS_REMOTESPACES_INDEXED(type, mpi_type)                            \
+  static KOKKOS_INLINE_FUNCTION void mpi_indexed_get(                          \
+      type *dst, const MPI_Aint *displs, const int nelems, const int pe,       \
+      const MPI_Win &win) {                                                    \
+    assert(win != MPI_WIN_NULL);                                               \
+    MPI_Datatype target;                                                       \
+    MPI_Type_create_hindexed_block(nelems, 1, displs, mpi_type, &target);      \
+    MPI_Type_commit(&target);                                                  \
+    MPI_Get(dst, nelems, mpi_type, pe, 0, 1, target, win);                     \
+    MPI_Type_free(&target);                                                    \
+  }                                                                            \
+  static KOKKOS_INLINE_FUNCTION void mpi_indexed_accumulate(                   \
+      const type *src, const MPI_Aint *displs, const int nelems, const int pe, \
+      const MPI_Win &win, MPI_Op op) {                                         \
+    assert(win != MPI_WIN_NULL);                                               \
+    MPI_Datatype target;                                                       \
+    MPI_Type_create_hindexed_block(nelems, 1, displs, mpi_type, &target);      \
+    MPI_Type_commit(&target);                                                  \
+    MPI_Accumulate(src, nelems, mpi_type, pe, 0, 1, target, op, win);          \
+    MPI_Type_free(&target);                                                    \
+  }
+
+KOKKOS_REMOTESPACES_INDEXED(char, MPI_SIGNED_CHAR)
+KOKKOS_REMOTESPACES_INDEXED(unsigned char, MPI_UNSIGNED_CHAR)
+KOKKOS_REMOTESPACES_INDEXED(short, MPI_SHORT)
+KOKKOS_REMOTESPACES_INDEXED(unsigned short, MPI_UNSIGNED_SHORT)
+KOKKOS_REMOTESPACES_INDEXED(int, MPI_INT)
+KOKKOS_REMOTESPACES_INDEXED(unsigned int, MPI_UNSIGNED)
+KOKKOS_REMOTESPACES_INDEXED(long, MPI_INT64_T)
+KOKKOS_REMOTESPACES_INDEXED(long long, MPI_LONG_LONG)
+KOKKOS_REMOTESPACES_INDEXED(unsigned long long, MPI_UNSIGNED_LONG_LONG)
+KOKKOS_REMOTESPACES_INDEXED(unsigned long, MPI_UNSIGNED_LONG)
+KOKKOS_REMOTESPACES_INDEXED(float, MPI_FLOAT)
+KOKKOS_REMOTESPACES_INDEXED(double, MPI_DOUBLE)
+
+#undef KOKKOS_REMOTESPACES_INDEXED
+
 template <class T, class Traits, typename Enable = void>
 struct MPIBlockDataElement {};
 
 template <class T, class Traits>
 struct MPIBlockDataElement<T, Traits> {
-  const MPI_Win win;
+  const MPIAccessLocation loc;
   T *ptr;
   int offset;
   int pe;
@@ -97,14 +180,15 @@ struct MPIBlockDataElement<T, Traits> {
   typedef T non_const_value_type;
 
   KOKKOS_INLINE_FUNCTION
-  MPIBlockDataElement(T *ptr_, MPI_Win win_, int pe_, size_t i_, size_t size_)
-      : win(win_), ptr(ptr_), offset(i_), pe(pe_), nelems(size_) {}
+  MPIBlockDataElement(T *ptr_, const MPIAccessLocation &loc_, int pe_,
+                      size_t i_, size_t size_)
+      : loc(loc_), ptr(ptr_), offset(i_), pe(pe_), nelems(size_) {}
 
   KOKKOS_INLINE_FUNCTION
-  void put() const { mpi_block_type_put(ptr, offset, nelems, pe, win); }
+  void put() const { mpi_block_type_put(ptr, offset, nelems, pe, loc); }
 
   KOKKOS_INLINE_FUNCTION
-  void get() const { mpi_block_type_get(ptr, offset, nelems, pe, win); }
+  void get() const { mpi_block_type_get(ptr, offset, nelems, pe, loc); }
 };
 
 }  // namespace Impl
@@ -31,18 +31,24 @@ struct MPIDataHandle {
   MPIDataHandle() : ptr(NULL), loc(MPI_WIN_NULL, 0) {}
 
   KOKKOS_INLINE_FUNCTION
-  MPIDataHandle(T *ptr_, MPI_Win win_ = MPI_WIN_NULL, size_t offset_ = 0)
-      : ptr(ptr_ + offset_), loc(win_, offset_) {}
+  MPIDataHandle(T *ptr_, MPI_Win win_ = MPI_WIN_NULL, size_t offset_ = 0,
+                MPIWindowState *state_ = nullptr)
+      : ptr(ptr_ + offset_), loc(win_, offset_, state_) {}
 
   KOKKOS_INLINE_FUNCTION
   MPIDataHandle(MPIDataHandle<T, Traits> const &arg)
       : ptr(arg.ptr), loc(arg.loc) {}
 
+  // Assignment from views with other traits, e.g. non-const to const
+  template <class U, class UTraits>
+  KOKKOS_INLINE_FUNCTION MPIDataHandle(MPIDataHandle<U, UTraits> const &arg)
+      : ptr(arg.ptr), loc(arg.loc) {}
+
   template <typename iType>
   KOKKOS_INLINE_FUNCTION MPIDataElement<T, Traits> operator()(
       const int &pe, const iType &i) const {
     assert(loc.win != MPI_WIN_NULL);
-    MPIDataElement<T, Traits> element(&loc.win, pe, i + loc.offset);
+    MPIDataElement<T, Traits> element(&loc, pe, i + loc.offset);
     return element;
   }
 
@@ -60,9 +66,9 @@ struct BlockDataHandle {
   size_t elems;
 
   KOKKOS_INLINE_FUNCTION
-  BlockDataHandle(T *ptr_, MPI_Win win_, size_t offset_, size_t elems_,
-                  size_t pe_)
-      : ptr(ptr_), loc(win_, offset_), elems(elems_), pe(pe_) {}
+  BlockDataHandle(T *ptr_, const MPIAccessLocation &loc_, size_t offset_,
+                  size_t elems_, size_t pe_)
+      : ptr(ptr_), loc(loc_.win, offset_, loc_.state), elems(elems_), pe(pe_) {}
 
   KOKKOS_INLINE_FUNCTION
   BlockDataHandle(BlockDataHandle<T, Traits> const &arg)
@@ -70,13 +76,13 @@ struct BlockDataHandle {
 
   KOKKOS_INLINE_FUNCTION
   void get() {
-    MPIBlockDataElement<T, Traits> element(ptr, loc.win, pe, loc.offset, elems);
+    MPIBlockDataElement<T, Traits> element(ptr, loc, pe, loc.offset, elems);
     element.get();
   }
 
   KOKKOS_INLINE_FUNCTION
   void put() {
-    MPIBlockDataElement<T, Traits> element(ptr, loc.win, pe, loc.offset, elems);
+    MPIBlockDataElement<T, Traits> element(ptr, loc, pe, loc.offset, elems);
     element.put();
   }
 };
@@ -112,7 +118,7 @@ struct ViewDataHandle<
   template <class SrcHandleType>
   KOKKOS_INLINE_FUNCTION static handle_type assign(
       SrcHandleType const arg_data_ptr, MPI_Win win, size_t offset) {
-    return handle_type(arg_data_ptr.ptr, win, offset);
+    return handle_type(arg_data_ptr.ptr, win, offset, arg_data_ptr.loc.state);
   }
 
   template <class SrcHandleType>
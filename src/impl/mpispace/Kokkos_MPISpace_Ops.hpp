@@ -24,15 +24,17 @@
 namespace Kokkos {
 namespace Impl {
 
-#define KOKKOS_REMOTESPACES_P(type, mpi_type)                                  \
-  static KOKKOS_INLINE_FUNCTION void mpi_type_p(                               \
-      const type val, const size_t offset, const int pe, const MPI_Win &win) { \
-    assert(win != MPI_WIN_NULL);                                               \
-    MPI_Request request;                                                       \
-    MPI_Rput(&val, 1, mpi_type, pe,                                            \
-             sizeof(SharedAllocationHeader) + offset * sizeof(type), 1,        \
-             mpi_type, win, &request);                                         \
-    MPI_Wait(&request, MPI_STATUS_IGNORE);                                     \
+#define KOKKOS_REMOTESPACES_P(type, mpi_type)                           \
+  static KOKKOS_INLINE_FUNCTION void mpi_type_p(                        \
+      const type val, const size_t offset, const int pe,                \
+      const MPIAccessLocation &loc) {                                   \
+    const MPI_Win &win = mpi_element_window(loc);                       \
+    assert(win != MPI_WIN_NULL);                                        \
+    MPI_Request request;                                                \
+    MPI_Rput(&val, 1, mpi_type, pe,                                     \
+             sizeof(SharedAllocationHeader) + offset * sizeof(type), 1, \
+             mpi_type, win, &request);                                  \
+    MPI_Wait(&request, MPI_STATUS_IGNORE);                              \
   }
 
 KOKKOS_REMOTESPACES_P(char, MPI_SIGNED_CHAR)
@@ -49,15 +51,35 @@ KOKKOS_REMOTESPACES_P(float, MPI_FLOAT)
 KOKKOS_REMOTESPACES_P(double, MPI_DOUBLE)
 #undef KOKKOS_REMOTESPACES_P
 
-#define KOKKOS_REMOTESPACES_G(type, mpi_type)                             \
-  static KOKKOS_INLINE_FUNCTION void mpi_type_g(                          \
-      type &val, const size_t offset, const int pe, const MPI_Win &win) { \
-    assert(win != MPI_WIN_NULL);                                          \
-    MPI_Request request;                                                  \
-    MPI_Rget(&val, 1, mpi_type, pe,                                       \
-             sizeof(SharedAllocationHeader) + offset * sizeof(type), 1,   \
-             mpi_type, win, &request);                                    \
-    MPI_Wait(&request, MPI_STATUS_IGNORE);                                \
+/* Reads observe the stores of the calling thread buffered by write
+ * combining */
+static KOKKOS_INLINE_FUNCTION void mpi_flush_combined_stores(
+    const MPIAccessLocation &loc, const int pe, const size_t offset,
+    const size_t nbytes) {
+#ifdef KRS_ENABLE_WRITE_COMBINING
+  mpi_combined_flush(loc, pe, offset, nbytes);
+#else
+  (void)loc;
+  (void)pe;
+  (void)offset;
+  (void)nbytes;
+#endif
+}
+
+#define KOKKOS_REMOTESPACES_G(type, mpi_type)                            \
+  static KOKKOS_INLINE_FUNCTION void mpi_type_g(                         \
+      type &val, const size_t offset, const int pe,                      \
+      const MPIAccessLocation &loc) {                                    \
+    const MPI_Win &win = mpi_element_window(loc);                        \
+    assert(win != MPI_WIN_NULL);                                         \
+    mpi_flush_combined_stores(                                           \
+        loc, pe, sizeof(SharedAllocationHeader) + offset * sizeof(type), \
+        sizeof(type));                                                   \
+    MPI_Request request;                                                 \
+    MPI_Rget(&val, 1, mpi_type, pe,                                      \
+             sizeof(SharedAllocationHeader) + offset * sizeof(type), 1,  \
+             mpi_type, win, &request);                                   \
+    MPI_Wait(&request, MPI_STATUS_IGNORE);                               \
   }
 
 KOKKOS_REMOTESPACES_G(char, MPI_SIGNED_CHAR)
@@ -74,9 +96,26 @@ KOKKOS_REMOTESPACES_G(float, MPI_FLOAT)
 KOKKOS_REMOTESPACES_G(double, MPI_DOUBLE)
 #undef KOKKOS_REMOTESPACES_G
 
+/* Atomic operations observe the calling thread's increments and
+ * decrements buffered by atomic aggregation */
+template <class T>
+static KOKKOS_INLINE_FUNCTION void mpi_flush_aggregated_adds(
+    const MPIAccessLocation &loc, const int pe, const size_t offset) {
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+  mpi_aggregated_flush<T>(loc, pe, offset);
+#else
+  (void)loc;
+  (void)pe;
+  (void)offset;
+#endif
+}
+
 #define KOKKOS_REMOTESPACES_ATOMIC_SET(type, mpi_type)                        \
   static KOKKOS_INLINE_FUNCTION void mpi_type_atomic_set(                     \
-      const type &val, int offset, int pe, const MPI_Win &win) {              \
+      const type &val, int offset, int pe, const MPIAccessLocation &loc) {    \
+    const MPI_Win &win = mpi_element_window(loc);                             \
+    mpi_flush_aggregated_adds<type>(                                          \
+        loc, pe, sizeof(SharedAllocationHeader) + offset * sizeof(type));     \
     MPI_Accumulate(&val, 1, mpi_type, pe,                                     \
                    sizeof(SharedAllocationHeader) + offset * sizeof(type), 1, \
                    mpi_type, MPI_REPLACE, win);                               \
@@ -99,7 +138,10 @@ KOKKOS_REMOTESPACES_ATOMIC_SET(double, MPI_DOUBLE)
 
 #define KOKKOS_REMOTESPACES_ATOMIC_FETCH(type, mpi_type)                     \
   static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_fetch(                  \
-      const type val, int offset, int pe, const MPI_Win &win) {              \
+      const type val, int offset, int pe, const MPIAccessLocation &loc) {    \
+    const MPI_Win &win = mpi_element_window(loc);                            \
+    mpi_flush_aggregated_adds<type>(                                         \
+        loc, pe, sizeof(SharedAllocationHeader) + offset * sizeof(type));    \
     type ret;                                                                \
     MPI_Fetch_and_op(&val, &ret, mpi_type, pe,                               \
                      sizeof(SharedAllocationHeader) + offset * sizeof(type), \
@@ -122,7 +164,8 @@ KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned long long, MPI_UNSIGNED_LONG_LONG)
 
 #define KOKKOS_REMOTESPACES_ATOMIC_ADD(type, mpi_type)                        \
   static KOKKOS_INLINE_FUNCTION void mpi_type_atomic_add(                     \
-      const type &val, int offset, int pe, const MPI_Win &win) {              \
+      const type &val, int offset, int pe, const MPIAccessLocation &loc) {    \
+    const MPI_Win &win = mpi_element_window(loc);                             \
     MPI_Accumulate(&val, 1, mpi_type, pe,                                     \
                    sizeof(SharedAllocationHeader) + offset * sizeof(type), 1, \
                    mpi_type, MPI_SUM, win);                                   \
@@ -145,7 +188,10 @@ KOKKOS_REMOTESPACES_ATOMIC_ADD(double, MPI_DOUBLE)
 
 #define KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(type, mpi_type)                 \
   static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_fetch_add(              \
-      const type &val, int offset, int pe, const MPI_Win &win) {             \
+      const type &val, int offset, int pe, const MPIAccessLocation &loc) {   \
+    const MPI_Win &win = mpi_element_window(loc);                            \
+    mpi_flush_aggregated_adds<type>(                                         \
+        loc, pe, sizeof(SharedAllocationHeader) + offset * sizeof(type));    \
     type ret;                                                                \
     MPI_Fetch_and_op(&val, &ret, mpi_type, pe,                               \
                      sizeof(SharedAllocationHeader) + offset * sizeof(type), \
@@ -168,16 +214,19 @@ KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(float, MPI_FLOAT)
 KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(double, MPI_DOUBLE)
 #undef KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD
 
-#define KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(type, mpi_type)       \
-  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_compare_swap(    \
-      const type &newval, const type &cond, int offset, int pe,       \
-      const MPI_Win &win) {                                           \
-    type ret;                                                         \
-    MPI_Compare_and_swap(                                             \
-        &newval, &cond, &ret, mpi_type, pe,                           \
-        sizeof(SharedAllocationHeader) + offset * sizeof(type), win); \
-    MPI_Win_flush(pe, win);                                           \
-    return ret;                                                       \
+#define KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(type, mpi_type)           \
+  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_compare_swap(        \
+      const type &newval, const type &cond, int offset, int pe,           \
+      const MPIAccessLocation &loc) {                                     \
+    const MPI_Win &win = mpi_element_window(loc);                         \
+    mpi_flush_aggregated_adds<type>(                                      \
+        loc, pe, sizeof(SharedAllocationHeader) + offset * sizeof(type)); \
+    type ret;                                                             \
+    MPI_Compare_and_swap(                                                 \
+        &newval, &cond, &ret, mpi_type, pe,                               \
+        sizeof(SharedAllocationHeader) + offset * sizeof(type), win);     \
+    MPI_Win_flush(pe, win);                                               \
+    return ret;                                                           \
   }
 
 KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(char, MPI_SIGNED_CHAR)
@@ -193,15 +242,18 @@ KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(unsigned long long,
                                         MPI_UNSIGNED_LONG_LONG)
 #undef KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP
 
-#define KOKKOS_REMOTESPACES_ATOMIC_SWAP(type, mpi_type)                      \
-  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_swap(                   \
-      const type &newval, int offset, int pe, const MPI_Win &win) {          \
-    type ret;                                                                \
-    MPI_Fetch_and_op(&newval, &ret, mpi_type, pe,                            \
-                     sizeof(SharedAllocationHeader) + offset * sizeof(type), \
-                     MPI_REPLACE, win);                                      \
-    MPI_Win_flush(pe, win);                                                  \
-    return ret;                                                              \
+#define KOKKOS_REMOTESPACES_ATOMIC_SWAP(type, mpi_type)                       \
+  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_swap(                    \
+      const type &newval, int offset, int pe, const MPIAccessLocation &loc) { \
+    const MPI_Win &win = mpi_element_window(loc);                             \
+    mpi_flush_aggregated_adds<type>(                                          \
+        loc, pe, sizeof(SharedAllocationHeader) + offset * sizeof(type));     \
+    type ret;                                                                 \
+    MPI_Fetch_and_op(&newval, &ret, mpi_type, pe,                             \
+                     sizeof(SharedAllocationHeader) + offset * sizeof(type),  \
+                     MPI_REPLACE, win);                                       \
+    MPI_Win_flush(pe, win);                                                   \
+    return ret;                                                               \
   }
 
 KOKKOS_REMOTESPACES_ATOMIC_SWAP(char, MPI_SIGNED_CHAR)
@@ -228,17 +280,27 @@ struct MPIDataElement<
     typename std::enable_if<Traits::memory_traits::is_atomic>::type> {
   typedef const T const_value_type;
   typedef T non_const_value_type;
-  const MPI_Win *win;
+  const MPIAccessLocation *loc;
   int offset;
   int pe;
 
   KOKKOS_INLINE_FUNCTION
-  MPIDataElement(MPI_Win *win_, int pe_, int i_)
-      : win(win_), offset(i_), pe(pe_) {}
+  MPIDataElement(const MPIAccessLocation *loc_, int pe_, int i_)
+      : loc(loc_), offset(i_), pe(pe_) {}
+
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+  // inc(), dec() and add() are deferred to the next fence; operators
+  // returning a value are issued immediately
+  KOKKOS_INLINE_FUNCTION
+  void aggregated_add(const_value_type &val) const {
+    mpi_aggregated_add(val, *loc, pe,
+                       sizeof(SharedAllocationHeader) + offset * sizeof(T));
+  }
+#endif
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator=(const_value_type &val) const {
-    mpi_type_atomic_set(val, offset, pe, *win);
+    mpi_type_atomic_set(val, offset, pe, *loc);
     return val;
   }
 
@@ -246,63 +308,81 @@ struct MPIDataElement<
   void inc() const {
     T tmp;
     tmp = 1;
-    mpi_type_atomic_add(tmp, offset, pe, *win);
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+    aggregated_add(tmp);
+#else
+    mpi_type_atomic_add(tmp, offset, pe, *loc);
+#endif
   }
 
   KOKKOS_INLINE_FUNCTION
   void dec() const {
     T tmp;
     tmp = 0 - 1;
-    mpi_type_atomic_add(tmp, offset, pe, *win);
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+    aggregated_add(tmp);
+#else
+    mpi_type_atomic_add(tmp, offset, pe, *loc);
+#endif
+  }
+
+  // Adds val without fetching the previous value
+  KOKKOS_INLINE_FUNCTION
+  void add(const_value_type &val) const {
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+    aggregated_add(val);
+#else
+    mpi_type_atomic_add(val, offset, pe, *loc);
+#endif
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++() const {
     T tmp;
     tmp = 1;
-    return mpi_type_atomic_fetch_add(tmp, offset, pe, *win) + tmp;
+    return mpi_type_atomic_fetch_add(tmp, offset, pe, *loc) + tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--() const {
     T tmp;
     tmp = 0 - 1;
-    return mpi_type_atomic_fetch_add(tmp, offset, pe, *win) + tmp;
+    return mpi_type_atomic_fetch_add(tmp, offset, pe, *loc) + tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++(int) const {
     T tmp;
     tmp = 1;
-    return mpi_type_atomic_fetch_add(tmp, offset, pe, *win);
+    return mpi_type_atomic_fetch_add(tmp, offset, pe, *loc);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--(int) const {
     T tmp;
     tmp = 0 - 1;
-    return mpi_type_atomic_fetch_add(tmp, offset, pe, *win);
+    return mpi_type_atomic_fetch_add(tmp, offset, pe, *loc);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+=(const_value_type &val) const {
-    return mpi_type_atomic_fetch_add(val, offset, pe, *win);
+    return mpi_type_atomic_fetch_add(val, offset, pe, *loc);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-=(const_value_type &val) const {
     T tmp;
     tmp = 0 - val;
-    return mpi_type_atomic_fetch_add(tmp, offset, pe, *win);
+    return mpi_type_atomic_fetch_add(tmp, offset, pe, *loc);
   }
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*=(const_value_type &val) const {
     T oldval, newval, tmp;
-    oldval = mpi_type_g(val, offset, pe, *win);
+    oldval = mpi_type_g(val, offset, pe, *loc);
     do {
       tmp    = oldval;
       newval = tmp * val;
-      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *win);
+      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *loc);
     } while (tmp != oldval);
     return tmp;
   }
@@ -310,11 +390,11 @@ struct MPIDataElement<
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/=(const_value_type &val) const {
     T oldval, newval, tmp;
-    oldval = mpi_type_g(val, offset, pe, *win);
+    oldval = mpi_type_g(val, offset, pe, *loc);
     do {
       tmp    = oldval;
       newval = tmp / val;
-      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *win);
+      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *loc);
     } while (tmp != oldval);
     return tmp;
   }
@@ -322,11 +402,11 @@ struct MPIDataElement<
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%=(const_value_type &val) const {
     T oldval, newval, tmp;
-    oldval = mpi_type_g(val, offset, pe, *win);
+    oldval = mpi_type_g(val, offset, pe, *loc);
     do {
       tmp    = oldval;
       newval = tmp % val;
-      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *win);
+      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *loc);
     } while (tmp != oldval);
     return tmp;
   }
@@ -334,11 +414,11 @@ struct MPIDataElement<
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&=(const_value_type &val) const {
     T oldval, newval, tmp;
-    oldval = mpi_type_g(val, offset, pe, *win);
+    oldval = mpi_type_g(val, offset, pe, *loc);
     do {
       tmp    = oldval;
       newval = tmp & val;
-      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *win);
+      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *loc);
     } while (tmp != oldval);
     return tmp;
   }
@@ -346,11 +426,11 @@ struct MPIDataElement<
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^=(const_value_type &val) const {
     T oldval, newval, tmp;
-    oldval = mpi_type_g(val, offset, pe, *win);
+    oldval = mpi_type_g(val, offset, pe, *loc);
     do {
       tmp    = oldval;
       newval = tmp ^ val;
-      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *win);
+      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *loc);
     } while (tmp != oldval);
     return tmp;
   }
@@ -358,11 +438,11 @@ struct MPIDataElement<
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|=(const_value_type &val) const {
     T oldval, newval, tmp;
-    oldval = mpi_type_g(val, offset, pe, *win);
+    oldval = mpi_type_g(val, offset, pe, *loc);
     do {
       tmp    = oldval;
       newval = tmp | val;
-      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *win);
+      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *loc);
     } while (tmp != oldval);
     return tmp;
   }
@@ -370,11 +450,11 @@ struct MPIDataElement<
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<=(const_value_type &val) const {
     T oldval, newval, tmp;
-    oldval = mpi_type_g(val, offset, pe, *win);
+    oldval = mpi_type_g(val, offset, pe, *loc);
     do {
       tmp    = oldval;
       newval = tmp << val;
-      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *win);
+      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *loc);
     } while (tmp != oldval);
     return tmp;
   }
@@ -382,11 +462,11 @@ struct MPIDataElement<
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>=(const_value_type &val) const {
     T oldval, newval, tmp;
-    oldval = mpi_type_g(val, offset, pe, *win);
+    oldval = mpi_type_g(val, offset, pe, *loc);
     do {
       tmp    = oldval;
       newval = tmp >> val;
-      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *win);
+      oldval = mpi_type_atomic_compare_swap(newval, tmp, offset, pe, *loc);
     } while (tmp != oldval);
     return tmp;
   }
@@ -394,147 +474,147 @@ struct MPIDataElement<
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp + val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp - val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp * val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp / val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp % val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator!() const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(tmp, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(tmp, offset, pe, *loc);
     return !tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&&(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp && val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator||(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp || val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp & val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp | val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp ^ val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator~() const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(tmp, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(tmp, offset, pe, *loc);
     return ~tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<(const unsigned int &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp << val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>(const unsigned int &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp >> val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator==(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp == val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator!=(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp != val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>=(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp >= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<=(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp <= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp < val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>(const_value_type &val) const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(val, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(val, offset, pe, *loc);
     return tmp > val;
   }
 
   KOKKOS_INLINE_FUNCTION
   operator const_value_type() const {
     T tmp;
-    tmp = mpi_type_atomic_fetch(tmp, offset, pe, *win);
+    tmp = mpi_type_atomic_fetch(tmp, offset, pe, *loc);
     return tmp;
   }
 };
@@ -543,312 +623,380 @@ struct MPIDataElement<
 template <class T, class Traits>
 struct MPIDataElement<
     T, Traits,
-    typename std::enable_if<!Traits::memory_traits::is_atomic>::type> {
+    typename std::enable_if<
+        !Traits::memory_traits::is_atomic &&
+        !Kokkos::Experimental::Impl::RemoteSpaces_Is_RACERlib_Cached<
+            Traits>::value &&
+        !Kokkos::Experimental::Impl::RemoteSpaces_Is_ReadOnly_Cached<
+            Traits>::value>::type> {
   typedef const T const_value_type;
-  typedef T non_const_value_type;
-  const MPI_Win *win;
+  typedef std::remove_const_t<T> non_const_value_type;
+  const MPIAccessLocation *loc;
   int offset;
   int pe;
 
   KOKKOS_INLINE_FUNCTION
-  MPIDataElement(MPI_Win *win_, int pe_, int i_)
-      : win(win_), offset(i_), pe(pe_) {}
+  MPIDataElement(const MPIAccessLocation *loc_, int pe_, int i_)
+      : loc(loc_), offset(i_), pe(pe_) {}
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator=(const_value_type &val) const {
-    mpi_type_p(val, offset, pe, *win);
+#ifdef KRS_ENABLE_WRITE_COMBINING
+    mpi_combined_put(&val, *loc, pe,
+                     sizeof(SharedAllocationHeader) + offset * sizeof(T),
+                     sizeof(T));
+#else
+    mpi_type_p(val, offset, pe, *loc);
+#endif
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   void inc() const {
     T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    mpi_type_g(val, offset, pe, *loc);
     val++;
-    mpi_type_p(val, offset, pe, *win);
+    mpi_type_p(val, offset, pe, *loc);
   }
 
   KOKKOS_INLINE_FUNCTION
   void dec() const {
     T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    mpi_type_g(val, offset, pe, *loc);
     val--;
-    mpi_type_p(val, offset, pe, *win);
+    mpi_type_p(val, offset, pe, *loc);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++() const {
     T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    mpi_type_g(val, offset, pe, *loc);
     val++;
-    mpi_type_p(val, offset, pe, *win);
+    mpi_type_p(val, offset, pe, *loc);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--() const {
     T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    mpi_type_g(val, offset, pe, *loc);
     val--;
-    mpi_type_p(val, offset, pe, *win);
+    mpi_type_p(val, offset, pe, *loc);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++(int) const {
     T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    mpi_type_g(val, offset, pe, *loc);
     val++;
-    mpi_type_p(val, offset, pe, *win);
+    mpi_type_p(val, offset, pe, *loc);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--(int) const {
     T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    mpi_type_g(val, offset, pe, *loc);
     val--;
-    mpi_type_p(val, offset, pe, *win);
+    mpi_type_p(val, offset, pe, *loc);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     tmp += val;
-    mpi_type_p(tmp, offset, pe, *win);
+    mpi_type_p(tmp, offset, pe, *loc);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     tmp -= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    mpi_type_p(tmp, offset, pe, *loc);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     tmp *= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    mpi_type_p(tmp, offset, pe, *loc);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     tmp /= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    mpi_type_p(tmp, offset, pe, *loc);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     tmp %= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    mpi_type_p(tmp, offset, pe, *loc);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     tmp &= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    mpi_type_p(tmp, offset, pe, *loc);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     tmp ^= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    mpi_type_p(tmp, offset, pe, *loc);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     tmp |= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    mpi_type_p(tmp, offset, pe, *loc);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     tmp <<= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    mpi_type_p(tmp, offset, pe, *loc);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     tmp >>= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    mpi_type_p(tmp, offset, pe, *loc);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp + val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp - val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp * val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp / val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp % val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator!() const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return !tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&&(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp && val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator||(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp || val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp & val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp | val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp ^ val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator~() const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return ~tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<(const unsigned int &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp << val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>(const unsigned int &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp >> val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator==(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp == val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator!=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp != val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp >= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<=(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp <= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp < val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>(const_value_type &val) const {
     T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    mpi_type_g(tmp, offset, pe, *loc);
     return tmp > val;
   }
 
   KOKKOS_INLINE_FUNCTION
   operator const_value_type() const {
-    T tmp;
-    mpi_type_g(tmp, offset, pe, *win);
+    non_const_value_type tmp;
+    mpi_type_g(tmp, offset, pe, *loc);
+    return tmp;
+  }
+};
+
+#ifdef KRS_ENABLE_RACERLIB
+// Cached Operators (read-only, served by RACERlib)
+template <class T, class Traits>
+struct MPIDataElement<
+    T, Traits,
+    typename std::enable_if<
+        Kokkos::Experimental::Impl::RemoteSpaces_Is_RACERlib_Cached<
+            Traits>::value>::type> {
+  typedef const T const_value_type;
+  typedef std::remove_const_t<T> non_const_value_type;
+  const MPIAccessLocation *loc;
+  int offset;
+  int pe;
+
+  KOKKOS_INLINE_FUNCTION
+  MPIDataElement(const MPIAccessLocation *loc_, int pe_, int i_)
+      : loc(loc_), offset(i_), pe(pe_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  operator const_value_type() const {
+    return Kokkos::Experimental::RACERlib::get<non_const_value_type>(
+        loc->state->racerlib_segment, pe,
+        sizeof(SharedAllocationHeader) + offset * sizeof(non_const_value_type));
+  }
+};
+#endif
+
+#ifdef KRS_ENABLE_READONLY_CACHE
+// Read-only Operators (const views, served by the line cache)
+template <class T, class Traits>
+struct MPIDataElement<
+    T, Traits,
+    typename std::enable_if<
+        Kokkos::Experimental::Impl::RemoteSpaces_Is_ReadOnly_Cached<
+            Traits>::value>::type> {
+  typedef const T const_value_type;
+  typedef std::remove_const_t<T> non_const_value_type;
+  const MPIAccessLocation *loc;
+  int offset;
+  int pe;
+
+  KOKKOS_INLINE_FUNCTION
+  MPIDataElement(const MPIAccessLocation *loc_, int pe_, int i_)
+      : loc(loc_), offset(i_), pe(pe_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  operator const_value_type() const {
+    non_const_value_type tmp;
+    mpi_cached_get(
+        &tmp, *loc, pe,
+        sizeof(SharedAllocationHeader) + offset * sizeof(non_const_value_type),
+        sizeof(non_const_value_type));
     return tmp;
   }
 };
+#endif
 
 }  // namespace Impl
 }  // namespace Kokkos
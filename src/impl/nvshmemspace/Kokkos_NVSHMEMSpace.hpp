@@ -180,5 +180,6 @@ struct MemorySpaceAccess<Kokkos::Experimental::NVSHMEMSpace,
 #include <Kokkos_NVSHMEMSpace_AllocationRecord.hpp>
 #include <Kokkos_NVSHMEMSpace_DataHandle.hpp>
 #include <Kokkos_RemoteSpaces_LocalDeepCopy.hpp>
+#include <Kokkos_RemoteSpaces_DualView.hpp>
 
 #endif  // #define KOKKOS_NVSHMEMSPACE_HPP
@@ -19,11 +19,55 @@
 #include <Kokkos_SHMEMSpace.hpp>
 #include <shmem.h>
 
+#ifdef KRS_ENABLE_READONLY_CACHE
+#include <Kokkos_RemoteSpaces_LineCache.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#ifndef KRS_READONLY_CACHE_MAX_ALLOCATIONS
+#define KRS_READONLY_CACHE_MAX_ALLOCATIONS 1024
+#endif
+#endif
+#ifdef KRS_ENABLE_WRITE_COMBINING
+#include <Kokkos_RemoteSpaces_WriteCombining.hpp>
+#endif
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+#include <Kokkos_RemoteSpaces_AtomicAggregation.hpp>
+#endif
+
 namespace Kokkos {
 namespace Experimental {
 
+#ifdef KRS_ENABLE_READONLY_CACHE
+namespace {
+Impl::RemoteSpaces_LineCache &readonly_cache() {
+  static Impl::RemoteSpaces_LineCache cache(KRS_READONLY_CACHE_LINES,
+                                            KRS_READONLY_CACHE_LINE_BYTES);
+  return cache;
+}
+
+/* Live symmetric allocations, bounding the lines fetched into the cache.
+ * Slots are claimed under the mutex and read lock-free up to the
+ * high-water mark. Reads of unregistered allocations bypass the cache. */
+struct SHMEMAllocation {
+  std::atomic<char *> base{nullptr};
+  std::atomic<size_t> size{0};
+};
+SHMEMAllocation shmem_allocations[KRS_READONLY_CACHE_MAX_ALLOCATIONS];
+std::atomic<int> shmem_allocations_end{0};
+std::mutex shmem_allocations_mutex;
+}  // namespace
+#endif
+
+#ifdef KRS_ENABLE_RACERLIB
+int SHMEMSpace::current_racerlib_segment;
+#endif
+
 /* Default allocation mechanism */
-SHMEMSpace::SHMEMSpace() : allocation_mode(Kokkos::Experimental::Symmetric) {}
+SHMEMSpace::SHMEMSpace() : allocation_mode(Kokkos::Experimental::Symmetric) {
+  Impl::initialize_topology();
+}
 
 void SHMEMSpace::impl_set_allocation_mode(const int allocation_mode_) {
   allocation_mode = allocation_mode_;
@@ -61,29 +105,44 @@ void *SHMEMSpace::impl_allocate(
   void *ptr = nullptr;
 
   if (arg_alloc_size) {
-    // Over-allocate to and round up to guarantee proper alignment.
-    size_t size_padded = arg_alloc_size + sizeof(void *) + alignment;
-
+    // The allocation header is placed so that the data following it is
+    // page aligned if it spans more than a page, leaving room before it to
+    // record the alloc'd pointer
+    const size_t data_alignment =
+        Impl::remote_spaces_data_alignment(arg_alloc_size);
+    size_t header_offset = Impl::remote_spaces_header_offset(data_alignment);
+    if (header_offset < sizeof(void *)) header_offset += data_alignment;
+    size_t size_padded = header_offset + arg_alloc_size;
+
+    void *alloc_ptr = nullptr;
     if (allocation_mode == Kokkos::Experimental::Symmetric) {
-      int num_pes = shmem_n_pes();
-      int my_id   = shmem_my_pe();
-      ptr         = shmem_malloc(size_padded);
+      alloc_ptr = shmem_align(data_alignment, size_padded);
     } else {
       Kokkos::abort("SHMEMSpace only supports symmetric allocation policy.");
     }
 
-    if (ptr) {
-      auto address = reinterpret_cast<uintptr_t>(ptr);
-
-      // offset enough to record the alloc_ptr
-      address += sizeof(void *);
-      uintptr_t rem    = address % alignment;
-      uintptr_t offset = rem ? (alignment - rem) : 0u;
-      address += offset;
-      ptr = reinterpret_cast<void *>(address);
+    if (alloc_ptr) {
+      ptr = static_cast<char *>(alloc_ptr) + header_offset;
       // record the alloc'd pointer
-      address -= sizeof(void *);
-      *reinterpret_cast<void **>(address) = ptr;
+      reinterpret_cast<void **>(ptr)[-1] = alloc_ptr;
+#ifdef KRS_ENABLE_RACERLIB
+      current_racerlib_segment =
+          RACERlib::register_allocation(ptr, arg_alloc_size);
+#endif
+#ifdef KRS_ENABLE_READONLY_CACHE
+      {
+        std::lock_guard<std::mutex> lock(shmem_allocations_mutex);
+        for (int i = 0; i < KRS_READONLY_CACHE_MAX_ALLOCATIONS; ++i) {
+          SHMEMAllocation &alloc = shmem_allocations[i];
+          if (alloc.base.load(std::memory_order_relaxed) != nullptr) continue;
+          alloc.size.store(arg_alloc_size, std::memory_order_relaxed);
+          alloc.base.store(static_cast<char *>(ptr), std::memory_order_release);
+          if (i >= shmem_allocations_end.load(std::memory_order_relaxed))
+            shmem_allocations_end.store(i + 1, std::memory_order_release);
+          break;
+        }
+      }
+#endif
     }
   }
 
@@ -136,11 +195,50 @@ void SHMEMSpace::impl_deallocate(
       Kokkos::Profiling::deallocateData(arg_handle, arg_label, arg_alloc_ptr,
                                         reported_size);
     }
-    shmem_free(arg_alloc_ptr);
+#ifdef KRS_ENABLE_RACERLIB
+    RACERlib::deregister_allocation(arg_alloc_ptr);
+#endif
+#ifdef KRS_ENABLE_WRITE_COMBINING
+    Impl::RemoteSpaces_WriteCombiner::flush_all();
+#endif
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+    Impl::RemoteSpaces_AtomicAggregator::flush_all();
+#endif
+#ifdef KRS_ENABLE_READONLY_CACHE
+    {
+      std::lock_guard<std::mutex> lock(shmem_allocations_mutex);
+      const int end = shmem_allocations_end.load(std::memory_order_relaxed);
+      for (int i = 0; i < end; ++i) {
+        SHMEMAllocation &alloc = shmem_allocations[i];
+        if (alloc.base.load(std::memory_order_relaxed) == arg_alloc_ptr) {
+          alloc.base.store(nullptr, std::memory_order_release);
+          break;
+        }
+      }
+      // Addresses may be reused by later allocations
+      readonly_cache().invalidate();
+    }
+#endif
+    shmem_free(reinterpret_cast<void **>(arg_alloc_ptr)[-1]);
   }
 }
 
-void SHMEMSpace::fence() { shmem_barrier_all(); }
+void SHMEMSpace::fence() {
+#ifdef KRS_ENABLE_RACERLIB
+  RACERlib::fence();
+#endif
+#ifdef KRS_ENABLE_WRITE_COMBINING
+  Impl::RemoteSpaces_WriteCombiner::flush_all();
+  shmem_quiet();
+#endif
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+  Impl::RemoteSpaces_AtomicAggregator::flush_all();
+#endif
+#ifdef KRS_ENABLE_READONLY_CACHE
+  readonly_cache().invalidate();
+#endif
+  shmem_barrier_all();
+}
 
 size_t get_num_pes() { return shmem_n_pes(); }
 size_t get_my_pe() { return shmem_my_pe(); }
@@ -149,14 +247,118 @@ size_t get_my_pe() { return shmem_my_pe(); }
 
 namespace Impl {
 
+#ifdef KRS_ENABLE_READONLY_CACHE
+void shmem_cached_get(void *dst, const void *ptr, int pe, size_t nbytes) {
+  const char *addr = static_cast<const char *>(ptr);
+  char *base       = nullptr;
+  size_t size      = 0;
+
+  // Lock-free, allocations are registered and freed outside of kernels
+  const int end = Kokkos::Experimental::shmem_allocations_end.load(
+      std::memory_order_acquire);
+  for (int i = 0; i < end; ++i) {
+    auto &alloc      = Kokkos::Experimental::shmem_allocations[i];
+    char *alloc_base = alloc.base.load(std::memory_order_acquire);
+    if (alloc_base == nullptr || addr < alloc_base) continue;
+    const size_t alloc_size = alloc.size.load(std::memory_order_relaxed);
+    if (addr < alloc_base + alloc_size) {
+      base = alloc_base;
+      size = alloc_size;
+      break;
+    }
+  }
+
+  auto &cache             = Kokkos::Experimental::readonly_cache();
+  const size_t line_bytes = cache.line_bytes();
+  const size_t offset     = addr - base;
+  const size_t line       = offset / line_bytes;
+  const size_t line_start = line * line_bytes;
+
+  if (base == nullptr || offset - line_start + nbytes > line_bytes) {
+    // Unknown allocation or element straddling two lines
+    shmem_getmem(dst, ptr, nbytes, pe);
+    return;
+  }
+
+  // Allocations are identified by their symmetric base address
+  Kokkos::Experimental::Impl::RemoteSpaces_LineKey key{
+      pe, int64_t(reinterpret_cast<uintptr_t>(base)), line};
+  cache.get(key, offset - line_start, nbytes, dst, [&](char *buf) {
+    size_t count = std::min(line_bytes, size - line_start);
+    shmem_getmem(buf, base + line_start, count, pe);
+  });
+}
+#endif
+
+#ifdef KRS_ENABLE_WRITE_COMBINING
+static void shmem_flush_run(
+    const Kokkos::Experimental::Impl::RemoteSpaces_WCRun &run) {
+  shmem_putmem(reinterpret_cast<void *>(run.start), run.data, run.nbytes,
+               run.pe);
+}
+
+void shmem_combined_put(void *ptr, const void *src, int pe, size_t nbytes) {
+  // Symmetric addresses are contiguous within an allocation
+  Kokkos::Experimental::Impl::RemoteSpaces_WriteCombiner::put(
+      pe, 0, reinterpret_cast<uintptr_t>(ptr), src, nbytes, shmem_flush_run);
+}
+
+void shmem_combined_flush(const void *ptr, int pe, size_t nbytes) {
+  // Gets are not ordered after puts, complete the put
+  if (Kokkos::Experimental::Impl::RemoteSpaces_WriteCombiner::flush(
+          pe, 0, reinterpret_cast<uintptr_t>(ptr), nbytes))
+    shmem_quiet();
+}
+#endif
+
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+template <class T>
+static void shmem_flush_atomic_batch(
+    const Kokkos::Experimental::Impl::RemoteSpaces_AtomicBatch<T> &batch) {
+  // Entries are keyed by symmetric address
+  const int64_t offset = 0;
+  for (size_t k = 0; k < batch.count; ++k)
+    shmem_indexed_add(&batch.values[k],
+                      reinterpret_cast<T *>(batch.offsets[k]), &offset, 1,
+                      batch.pe);
+}
+
+#define KOKKOS_REMOTESPACES_AGGREGATED_ADD(type)                          \
+  void shmem_aggregated_add(type *ptr, const type &val, int pe) {         \
+    Kokkos::Experimental::Impl::RemoteSpaces_AtomicAggregator::add(       \
+        pe, 0, reinterpret_cast<uintptr_t>(ptr), val,                     \
+        shmem_flush_atomic_batch<type>);                                  \
+  }                                                                       \
+  void shmem_aggregated_flush(type *ptr, int pe) {                        \
+    /* Order the flushed adds before the following atomic operation */    \
+    if (Kokkos::Experimental::Impl::RemoteSpaces_AtomicAggregator::flush< \
+            type>(pe, 0, reinterpret_cast<uintptr_t>(ptr)))               \
+      shmem_fence();                                                      \
+  }
+
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(int)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned int)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(long long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned long long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(float)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(double)
+#undef KOKKOS_REMOTESPACES_AGGREGATED_ADD
+#endif
+
 Kokkos::Impl::DeepCopy<HostSpace, Kokkos::Experimental::SHMEMSpace>::DeepCopy(
     void *dst, const void *src, size_t n) {
-  memcpy(dst, src, n);
+  Kokkos::DefaultHostExecutionSpace exec;
+  remote_spaces_parallel_memcpy(exec, dst, src, n);
+  exec.fence();
 }
 
 Kokkos::Impl::DeepCopy<Kokkos::Experimental::SHMEMSpace, HostSpace>::DeepCopy(
     void *dst, const void *src, size_t n) {
-  memcpy(dst, src, n);
+  Kokkos::DefaultHostExecutionSpace exec;
+  remote_spaces_parallel_memcpy(exec, dst, src, n);
+  exec.fence();
 }
 
 Kokkos::Impl::DeepCopy<Kokkos::Experimental::SHMEMSpace,
@@ -164,24 +366,9 @@ Kokkos::Impl::DeepCopy<Kokkos::Experimental::SHMEMSpace,
                                                                    const void
                                                                        *src,
                                                                    size_t n) {
-  memcpy(dst, src, n);
-}
-
-template <typename ExecutionSpace>
-Kokkos::Impl::DeepCopy<Kokkos::Experimental::SHMEMSpace,
-                       Kokkos::Experimental::SHMEMSpace,
-                       ExecutionSpace>::DeepCopy(void *dst, const void *src,
-                                                 size_t n) {
-  memcpy(dst, src, n);
-}
-
-template <typename ExecutionSpace>
-Kokkos::Impl::DeepCopy<Kokkos::Experimental::SHMEMSpace,
-                       Kokkos::Experimental::SHMEMSpace,
-                       ExecutionSpace>::DeepCopy(const ExecutionSpace &exec,
-                                                 void *dst, const void *src,
-                                                 size_t n) {
-  memcpy(dst, src, n);
+  Kokkos::DefaultHostExecutionSpace exec;
+  remote_spaces_parallel_memcpy(exec, dst, src, n);
+  exec.fence();
 }
 
 }  // namespace Impl
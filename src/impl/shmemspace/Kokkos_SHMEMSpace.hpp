@@ -25,6 +25,7 @@
 #include <typeinfo>
 
 #include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces_ParallelCopy.hpp>
 
 #include <Kokkos_RemoteSpaces.hpp>
 #include <mpi.h>
@@ -94,6 +95,10 @@ class SHMEMSpace {
   int allocation_mode;
   int64_t extent;
 
+#ifdef KRS_ENABLE_RACERLIB
+  static int current_racerlib_segment;
+#endif
+
   void impl_set_allocation_mode(const int);
   void impl_set_extent(int64_t N);
 
@@ -115,24 +120,61 @@ namespace Impl {
 template <>
 struct DeepCopy<HostSpace, Kokkos::Experimental::SHMEMSpace> {
   DeepCopy(void *dst, const void *src, size_t);
+  template <class ExecutionSpace>
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
 };
 
 template <>
 struct DeepCopy<Kokkos::Experimental::SHMEMSpace, HostSpace> {
   DeepCopy(void *dst, const void *src, size_t);
+  template <class ExecutionSpace>
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
 };
 
 template <>
 struct DeepCopy<Kokkos::Experimental::SHMEMSpace,
                 Kokkos::Experimental::SHMEMSpace> {
   DeepCopy(void *dst, const void *src, size_t);
+  template <class ExecutionSpace>
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
+};
+
+template <class ExecutionSpace>
+struct DeepCopy<HostSpace, Kokkos::Experimental::SHMEMSpace, ExecutionSpace> {
+  DeepCopy(void *dst, const void *src, size_t n) {
+    DeepCopy<HostSpace, Kokkos::Experimental::SHMEMSpace>(dst, src, n);
+  }
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
+};
+
+template <class ExecutionSpace>
+struct DeepCopy<Kokkos::Experimental::SHMEMSpace, HostSpace, ExecutionSpace> {
+  DeepCopy(void *dst, const void *src, size_t n) {
+    DeepCopy<Kokkos::Experimental::SHMEMSpace, HostSpace>(dst, src, n);
+  }
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
 };
 
 template <class ExecutionSpace>
 struct DeepCopy<Kokkos::Experimental::SHMEMSpace,
                 Kokkos::Experimental::SHMEMSpace, ExecutionSpace> {
-  DeepCopy(void *dst, const void *src, size_t n);
-  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n);
+  DeepCopy(void *dst, const void *src, size_t n) {
+    using space_t = Kokkos::Experimental::SHMEMSpace;
+    DeepCopy<space_t, space_t>(dst, src, n);
+  }
+  DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n) {
+    remote_spaces_host_deep_copy(exec, dst, src, n);
+  }
 };
 
 template <>
@@ -157,11 +199,51 @@ struct MemorySpaceAccess<Kokkos::Experimental::SHMEMSpace, Kokkos::HostSpace> {
   enum { deepcopy = true };
 };
 
+#ifdef KRS_ENABLE_READONLY_CACHE
+/* Reads nbytes at symmetric address ptr on pe through the read-only line
+ * cache. Cached lines are discarded by SHMEMSpace::fence. */
+void shmem_cached_get(void *dst, const void *ptr, int pe, size_t nbytes);
+#endif
+
+#ifdef KRS_ENABLE_WRITE_COMBINING
+/* Buffers a store of nbytes to symmetric address ptr on pe. Contiguous
+ * stores are combined and written out as block puts, at the latest by
+ * SHMEMSpace::fence. */
+void shmem_combined_put(void *ptr, const void *src, int pe, size_t nbytes);
+
+/* Completes the calling thread's buffered stores overlapping nbytes at
+ * symmetric address ptr on pe, before they are read. */
+void shmem_combined_flush(const void *ptr, int pe, size_t nbytes);
+#endif
+
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+/* Buffers an atomic add of val to symmetric address ptr on pe. Adds to the
+ * same element are merged and applied at the latest by SHMEMSpace::fence.
+ * shmem_aggregated_flush issues the calling thread's buffered adds to ptr
+ * on pe ahead of another atomic operation on it. */
+#define KOKKOS_REMOTESPACES_AGGREGATED_ADD(type)                 \
+  void shmem_aggregated_add(type *ptr, const type &val, int pe); \
+  void shmem_aggregated_flush(type *ptr, int pe);
+
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(int)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned int)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(long long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(unsigned long long)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(float)
+KOKKOS_REMOTESPACES_AGGREGATED_ADD(double)
+#undef KOKKOS_REMOTESPACES_AGGREGATED_ADD
+#endif
+
 }  // namespace Impl
 }  // namespace Kokkos
 
 #include <Kokkos_RemoteSpaces_Error.hpp>
 #include <Kokkos_RemoteSpaces_Options.hpp>
+#ifdef KRS_ENABLE_RACERLIB
+#include <RACERlib_Interface.hpp>
+#endif
 #include <Kokkos_SHMEMSpace_ViewTraits.hpp>
 #include <Kokkos_RemoteSpaces_ViewLayout.hpp>
 #include <Kokkos_RemoteSpaces_Helpers.hpp>
@@ -173,5 +255,19 @@ struct MemorySpaceAccess<Kokkos::Experimental::SHMEMSpace, Kokkos::HostSpace> {
 #include <Kokkos_SHMEMSpace_AllocationRecord.hpp>
 #include <Kokkos_SHMEMSpace_DataHandle.hpp>
 #include <Kokkos_RemoteSpaces_LocalDeepCopy.hpp>
+#include <Kokkos_RemoteSpaces_Prefetch.hpp>
+#include <Kokkos_RemoteSpaces_AsyncGet.hpp>
+#include <Kokkos_RemoteSpaces_IndexLists.hpp>
+#include <Kokkos_RemoteSpaces_GatherPlan.hpp>
+#include <Kokkos_RemoteSpaces_GatherScatter.hpp>
+#include <Kokkos_RemoteSpaces_ScatterView.hpp>
+#include <Kokkos_RemoteSpaces_DualView.hpp>
+#include <Kokkos_RemoteSpaces_DeepCopyAsync.hpp>
+#include <Kokkos_RemoteSpaces_Redistribute.hpp>
+#include <Kokkos_RemoteSpaces_RootTransfers.hpp>
+#include <Kokkos_RemoteSpaces_Transpose.hpp>
+#include <Kokkos_RemoteSpaces_CommPlan.hpp>
+#include <Kokkos_RemoteSpaces_GhostedView.hpp>
+#include <Kokkos_RemoteSpaces_NeighborSync.hpp>
 
 #endif  // #define KOKKOS_SHMEMSPACE_HPP
@@ -79,6 +79,9 @@ SharedAllocationRecord<Kokkos::Experimental::SHMEMSpace, void>::
   this->base_t::_fill_host_accessible_header_info(*RecordBase::m_alloc_ptr,
                                                   arg_label);
 #endif
+#ifdef KRS_ENABLE_RACERLIB
+  racerlib_segment = m_space.current_racerlib_segment;
+#endif
 }
 
 }  // namespace Impl
@@ -73,6 +73,9 @@ class SharedAllocationRecord<Kokkos::Experimental::SHMEMSpace, void>
 #else
     this->base_t::_fill_host_accessible_header_info(*RecordBase::m_alloc_ptr,
                                                     arg_label);
+#endif
+#ifdef KRS_ENABLE_RACERLIB
+    racerlib_segment = m_space.current_racerlib_segment;
 #endif
   }
 
@@ -82,6 +85,10 @@ class SharedAllocationRecord<Kokkos::Experimental::SHMEMSpace, void>
       const RecordBase::function_type arg_dealloc = &deallocate);
 
  public:
+#ifdef KRS_ENABLE_RACERLIB
+  int racerlib_segment;
+#endif
+
   KOKKOS_INLINE_FUNCTION static SharedAllocationRecord* allocate(
       const Kokkos::Experimental::SHMEMSpace& arg_space,
       const std::string& arg_label, const size_t arg_alloc_size) {
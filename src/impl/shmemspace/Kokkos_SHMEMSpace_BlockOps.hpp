@@ -67,6 +67,45 @@ KOKKOS_REMOTESPACES_GET(double, shmem_double_get)
 
 #undef KOKKOS_REMOTESPACES_GET
 
+static KOKKOS_INLINE_FUNCTION void shmem_block_get_nbi(void *dst,
+                                                       const void *src,
+                                                       size_t nbytes, int pe) {
+  shmem_getmem_nbi(dst, src, nbytes, pe);
+}
+
+static KOKKOS_INLINE_FUNCTION void shmem_block_put_nbi(void *dst,
+                                                       const void *src,
+                                                       size_t nbytes, int pe) {
+  shmem_putmem_nbi(dst, src, nbytes, pe);
+}
+
+/* Indexed transfers between a packed local buffer and the symmetric
+ * addresses base + offsets[k] on pe. Transfers are non-blocking where
+ * OpenSHMEM allows it; completion is left to the caller (shmem_quiet). */
+template <class T>
+static KOKKOS_INLINE_FUNCTION void shmem_indexed_get(T *dst, const T *base,
+                                                     const int64_t *offsets,
+                                                     size_t nelems, int pe) {
+  for (size_t k = 0; k < nelems; ++k)
+    shmem_getmem_nbi(dst + k, base + offsets[k], sizeof(T), pe);
+}
+
+template <class T>
+static KOKKOS_INLINE_FUNCTION void shmem_indexed_put(const T *src, T *base,
+                                                     const int64_t *offsets,
+                                                     size_t nelems, int pe) {
+  for (size_t k = 0; k < nelems; ++k)
+    shmem_putmem_nbi(base + offsets[k], src + k, sizeof(T), pe);
+}
+
+template <class T>
+static KOKKOS_INLINE_FUNCTION void shmem_indexed_add(const T *src, T *base,
+                                                     const int64_t *offsets,
+                                                     size_t nelems, int pe) {
+  for (size_t k = 0; k < nelems; ++k)
+    shmem_type_atomic_add(base + offsets[k], src[k], pe);
+}
+
 template <class T, class Traits, typename Enable = void>
 struct SHMEMBlockDataElement {};
 
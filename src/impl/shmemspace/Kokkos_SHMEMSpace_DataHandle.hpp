@@ -25,7 +25,27 @@ namespace Impl {
 template <class T, class Traits>
 struct SHMEMDataHandle {
   T *ptr;
+#ifdef KRS_ENABLE_RACERLIB
+  // RACERlib segment of the allocation, resolved when it is registered
+  int racerlib_segment;
 
+  KOKKOS_INLINE_FUNCTION
+  SHMEMDataHandle() : ptr(NULL), racerlib_segment(-1) {}
+
+  KOKKOS_INLINE_FUNCTION
+  SHMEMDataHandle(T *ptr_, int racerlib_segment_ = -1)
+      : ptr(ptr_), racerlib_segment(racerlib_segment_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  SHMEMDataHandle(SHMEMDataHandle<T, Traits> const &arg)
+      : ptr(arg.ptr), racerlib_segment(arg.racerlib_segment) {}
+
+  // Assignment from views with other traits, e.g. non-const to const
+  template <class U, class UTraits>
+  KOKKOS_INLINE_FUNCTION SHMEMDataHandle(
+      SHMEMDataHandle<U, UTraits> const &arg, size_t offset = 0)
+      : ptr(arg.ptr + offset), racerlib_segment(arg.racerlib_segment) {}
+#else
   KOKKOS_INLINE_FUNCTION
   SHMEMDataHandle() : ptr(NULL) {}
 
@@ -35,11 +55,23 @@ struct SHMEMDataHandle {
   KOKKOS_INLINE_FUNCTION
   SHMEMDataHandle(SHMEMDataHandle<T, Traits> const &arg) : ptr(arg.ptr) {}
 
+  // Assignment from views with other traits, e.g. non-const to const
+  template <class U, class UTraits>
+  KOKKOS_INLINE_FUNCTION SHMEMDataHandle(
+      SHMEMDataHandle<U, UTraits> const &arg, size_t offset = 0)
+      : ptr(arg.ptr + offset) {}
+#endif
+
   template <typename iType>
   KOKKOS_INLINE_FUNCTION SHMEMDataElement<T, Traits> operator()(
       const int &pe, const iType &i) const {
-    SHMEMDataElement<T, Traits> element(ptr, pe, i);
-    return element;
+#ifdef KRS_ENABLE_RACERLIB
+    if constexpr (Kokkos::Experimental::Impl::RemoteSpaces_Is_RACERlib_Cached<
+                      Traits>::value)
+      return SHMEMDataElement<T, Traits>(ptr, racerlib_segment, pe, i);
+    else
+#endif
+      return SHMEMDataElement<T, Traits>(ptr, pe, i);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -100,10 +132,11 @@ struct ViewDataHandle<
     return handle_type(arg_data_ptr);
   }
 
+  // Subviews keep the RACERlib segment of the original view
   template <class SrcHandleType>
   KOKKOS_INLINE_FUNCTION static handle_type assign(
       SrcHandleType const arg_data_ptr, size_t offset) {
-    return handle_type(arg_data_ptr + offset);
+    return handle_type(arg_data_ptr, offset);
   }
 
   template <class SrcHandleType>
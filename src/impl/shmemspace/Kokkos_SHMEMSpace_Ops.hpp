@@ -20,6 +20,7 @@
 #define KOKKOS_REMOTESPACES_SHMEM_OPS_HPP
 
 #include <shmem.h>
+#include <cstring>
 #include <type_traits>
 
 namespace Kokkos {
@@ -46,8 +47,22 @@ KOKKOS_REMOTESPACES_P(double, shmem_double_p)
 
 #undef KOKKOS_REMOTESPACES_P
 
+/* Reads observe the stores of the calling thread buffered by write
+ * combining */
+static KOKKOS_INLINE_FUNCTION void shmem_flush_combined_stores(
+    const void *ptr, const int pe, const size_t nbytes) {
+#ifdef KRS_ENABLE_WRITE_COMBINING
+  shmem_combined_flush(ptr, pe, nbytes);
+#else
+  (void)ptr;
+  (void)pe;
+  (void)nbytes;
+#endif
+}
+
 #define KOKKOS_REMOTESPACES_G(type, op)                                \
   static KOKKOS_INLINE_FUNCTION type shmem_type_g(type *ptr, int pe) { \
+    shmem_flush_combined_stores(ptr, pe, sizeof(type));                \
     return op(ptr, pe);                                                \
   }
 
@@ -66,9 +81,23 @@ KOKKOS_REMOTESPACES_G(double, shmem_double_g)
 
 #undef KOKKOS_REMOTESPACES_G
 
+/* Atomic operations observe the calling thread's increments and
+ * decrements buffered by atomic aggregation */
+template <class T>
+static KOKKOS_INLINE_FUNCTION void shmem_flush_aggregated_adds(T *ptr,
+                                                               const int pe) {
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+  shmem_aggregated_flush(ptr, pe);
+#else
+  (void)ptr;
+  (void)pe;
+#endif
+}
+
 #define KOKKOS_REMOTESPACES_ATOMIC_SET(type, op)            \
   static KOKKOS_INLINE_FUNCTION void shmem_type_atomic_set( \
       type *ptr, type value, int pe) {                      \
+    shmem_flush_aggregated_adds(ptr, pe);                   \
     return op(ptr, value, pe);                              \
   }
 
@@ -86,6 +115,7 @@ KOKKOS_REMOTESPACES_ATOMIC_SET(double, shmem_double_atomic_set)
 #define KOKKOS_REMOTESPACES_ATOMIC_FETCH(type, op)                      \
   static KOKKOS_INLINE_FUNCTION type shmem_type_atomic_fetch(type *ptr, \
                                                              int pe) {  \
+    shmem_flush_aggregated_adds(ptr, pe);                               \
     return op(ptr, pe);                                                 \
   }
 
@@ -119,6 +149,7 @@ KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned long long, shmem_ulonglong_atomic_add)
 #define KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(type, op)            \
   static KOKKOS_INLINE_FUNCTION type shmem_type_atomic_fetch_add( \
       type *ptr, type value, int pe) {                            \
+    shmem_flush_aggregated_adds(ptr, pe);                         \
     return op(ptr, value, pe);                                    \
   }
 
@@ -133,9 +164,48 @@ KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(unsigned long long,
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD
 
+/* OpenSHMEM has no floating-point atomic add; emulate it with a
+ * compare-and-swap loop on the bit pattern */
+#define KOKKOS_REMOTESPACES_ATOMIC_EMULATED_ADD(type, int_type, fetch, cswap) \
+  static KOKKOS_INLINE_FUNCTION type shmem_type_emulated_fetch_add(           \
+      type *ptr, type value, int pe) {                                        \
+    static_assert(sizeof(type) == sizeof(int_type), "Size mismatch");         \
+    int_type *addr = reinterpret_cast<int_type *>(ptr);                       \
+    int_type old   = fetch(addr, pe);                                         \
+    for (;;) {                                                                \
+      type val;                                                               \
+      int_type desired;                                                       \
+      memcpy(&val, &old, sizeof(type));                                       \
+      const type ret = val;                                                   \
+      val += value;                                                           \
+      memcpy(&desired, &val, sizeof(type));                                   \
+      int_type prev = cswap(addr, old, desired, pe);                          \
+      if (prev == old) return ret;                                            \
+      old = prev;                                                             \
+    }                                                                         \
+  }                                                                           \
+  static KOKKOS_INLINE_FUNCTION void shmem_type_atomic_add(                   \
+      type *ptr, type value, int pe) {                                        \
+    shmem_type_emulated_fetch_add(ptr, value, pe);                            \
+  }                                                                           \
+  static KOKKOS_INLINE_FUNCTION type shmem_type_atomic_fetch_add(             \
+      type *ptr, type value, int pe) {                                        \
+    shmem_flush_aggregated_adds(ptr, pe);                                     \
+    return shmem_type_emulated_fetch_add(ptr, value, pe);                     \
+  }
+
+KOKKOS_REMOTESPACES_ATOMIC_EMULATED_ADD(float, int, shmem_int_atomic_fetch,
+                                        shmem_int_atomic_compare_swap)
+KOKKOS_REMOTESPACES_ATOMIC_EMULATED_ADD(double, long long,
+                                        shmem_longlong_atomic_fetch,
+                                        shmem_longlong_atomic_compare_swap)
+
+#undef KOKKOS_REMOTESPACES_ATOMIC_EMULATED_ADD
+
 #define KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(type, op)            \
   static KOKKOS_INLINE_FUNCTION type shmem_type_atomic_compare_swap( \
       type *ptr, type cond, type value, int pe) {                    \
+    shmem_flush_aggregated_adds(ptr, pe);                            \
     return op(ptr, cond, value, pe);                                 \
   }
 KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(int, shmem_int_atomic_compare_swap)
@@ -154,6 +224,7 @@ KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(unsigned long long,
 #define KOKKOS_REMOTESPACES_ATOMIC_SWAP(type, op)            \
   static KOKKOS_INLINE_FUNCTION type shmem_type_atomic_swap( \
       type *ptr, type value, int pe) {                       \
+    shmem_flush_aggregated_adds(ptr, pe);                    \
     return op(ptr, value, pe);                               \
   }
 KOKKOS_REMOTESPACES_ATOMIC_SWAP(int, shmem_int_atomic_swap)
@@ -183,6 +254,15 @@ struct SHMEMDataElement<
   KOKKOS_INLINE_FUNCTION
   SHMEMDataElement(T *ptr_, int pe_, int i_) : ptr(ptr_ + i_), pe(pe_) {}
 
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+  // inc(), dec() and add() are deferred to the next fence; operators
+  // returning a value are issued immediately
+  KOKKOS_INLINE_FUNCTION
+  void aggregated_add(const_value_type &val) const {
+    shmem_aggregated_add(ptr, val, pe);
+  }
+#endif
+
   KOKKOS_INLINE_FUNCTION
   const_value_type operator=(const_value_type &val) const {
     shmem_type_atomic_set(ptr, val, pe);
@@ -193,14 +273,32 @@ struct SHMEMDataElement<
   void inc() const {
     T tmp;
     tmp = 1;
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+    aggregated_add(tmp);
+#else
     shmem_type_atomic_add(ptr, tmp, pe);
+#endif
   }
 
   KOKKOS_INLINE_FUNCTION
   void dec() const {
     T tmp;
     tmp = 0 - 1;
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+    aggregated_add(tmp);
+#else
     shmem_type_atomic_add(ptr, tmp, pe);
+#endif
+  }
+
+  // Adds val without fetching the previous value
+  KOKKOS_INLINE_FUNCTION
+  void add(const_value_type &val) const {
+#ifdef KRS_ENABLE_ATOMIC_AGGREGATION
+    aggregated_add(val);
+#else
+    shmem_type_atomic_add(ptr, val, pe);
+#endif
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -491,9 +589,14 @@ struct SHMEMDataElement<
 template <class T, class Traits>
 struct SHMEMDataElement<
     T, Traits,
-    typename std::enable_if<!Traits::memory_traits::is_atomic>::type> {
+    typename std::enable_if<
+        !Traits::memory_traits::is_atomic &&
+        !Kokkos::Experimental::Impl::RemoteSpaces_Is_RACERlib_Cached<
+            Traits>::value &&
+        !Kokkos::Experimental::Impl::RemoteSpaces_Is_ReadOnly_Cached<
+            Traits>::value>::type> {
   typedef const T const_value_type;
-  typedef T non_const_value_type;
+  typedef std::remove_const_t<T> non_const_value_type;
   T *ptr;
   int pe;
 
@@ -502,7 +605,11 @@ struct SHMEMDataElement<
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator=(const_value_type &val) const {
+#ifdef KRS_ENABLE_WRITE_COMBINING
+    shmem_combined_put(ptr, &val, pe, sizeof(T));
+#else
     shmem_type_p(ptr, val, pe);
+#endif
     return val;
   }
 
@@ -790,11 +897,60 @@ struct SHMEMDataElement<
 
   KOKKOS_INLINE_FUNCTION
   operator const_value_type() const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    return shmem_type_g(const_cast<non_const_value_type *>(ptr), pe);
+  }
+};
+
+#ifdef KRS_ENABLE_RACERLIB
+// Cached Operators (read-only, served by RACERlib)
+template <class T, class Traits>
+struct SHMEMDataElement<
+    T, Traits,
+    typename std::enable_if<
+        Kokkos::Experimental::Impl::RemoteSpaces_Is_RACERlib_Cached<
+            Traits>::value>::type> {
+  typedef const T const_value_type;
+  typedef std::remove_const_t<T> non_const_value_type;
+  T *ptr;
+  int segment;
+  int pe;
+
+  KOKKOS_INLINE_FUNCTION
+  SHMEMDataElement(T *ptr_, int segment_, int pe_, int i_)
+      : ptr(ptr_ + i_), segment(segment_), pe(pe_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  operator const_value_type() const {
+    return Kokkos::Experimental::RACERlib::get<non_const_value_type>(
+        ptr, segment, pe);
+  }
+};
+#endif
+
+#ifdef KRS_ENABLE_READONLY_CACHE
+// Read-only Operators (const views, served by the line cache)
+template <class T, class Traits>
+struct SHMEMDataElement<
+    T, Traits,
+    typename std::enable_if<
+        Kokkos::Experimental::Impl::RemoteSpaces_Is_ReadOnly_Cached<
+            Traits>::value>::type> {
+  typedef const T const_value_type;
+  typedef std::remove_const_t<T> non_const_value_type;
+  T *ptr;
+  int pe;
+
+  KOKKOS_INLINE_FUNCTION
+  SHMEMDataElement(T *ptr_, int pe_, int i_) : ptr(ptr_ + i_), pe(pe_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  operator const_value_type() const {
+    non_const_value_type tmp;
+    shmem_cached_get(&tmp, ptr, pe, sizeof(non_const_value_type));
     return tmp;
   }
 };
+#endif
 
 }  // namespace Impl
 }  // namespace Kokkos
@@ -140,3 +140,48 @@ TEST(TEST_CATEGORY, test_allocate_symmetric_remote_view_by_rank) {
 
   RemoteSpace_t::fence();
 }
+
+template <class DataType, class Layout, class RemoteSpace, class... Args>
+void test_allocate_padded_remote_view(Args... args) {
+  using RemoteView_t = Kokkos::View<DataType, Layout, RemoteSpace>;
+  using value_type   = typename RemoteView_t::value_type;
+
+  RemoteView_t view(Kokkos::view_alloc("MyRemoteView", Kokkos::AllowPadding),
+                    args...);
+
+  // Padded strides keep rows of the local block on cache-line boundaries
+  size_t stride = std::is_same<Layout, Kokkos::LayoutLeft>::value
+                      ? view.stride(1)
+                      : view.stride(0);
+  ASSERT_EQ(stride * sizeof(value_type) %
+                Kokkos::Experimental::Impl::RemoteSpaces_LineAlignment,
+            0);
+  ASSERT_GE(view.span(), view.size());
+
+  // Data spanning more than a page starts on a page boundary
+  size_t data_alignment =
+      view.impl_map().memory_span() >
+              Kokkos::Experimental::Impl::RemoteSpaces_PageAlignment
+          ? Kokkos::Experimental::Impl::RemoteSpaces_PageAlignment
+          : Kokkos::Impl::MEMORY_ALIGNMENT;
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(view.data()) % data_alignment, 0u);
+}
+
+TEST(TEST_CATEGORY, test_allocate_padded_remote_view) {
+  using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+  using PLR_t         = Kokkos::PartitionedLayoutRight;
+  using LL_t          = Kokkos::LayoutLeft;
+  using LR_t          = Kokkos::LayoutRight;
+
+  int numRanks;
+  MPI_Comm_size(MPI_COMM_WORLD, &numRanks);
+
+  test_allocate_padded_remote_view<double **, PLR_t, RemoteSpace_t>(numRanks,
+                                                                    113);
+  test_allocate_padded_remote_view<double **, LR_t, RemoteSpace_t>(
+      numRanks * 7, 113);
+  test_allocate_padded_remote_view<double **, LL_t, RemoteSpace_t>(
+      numRanks * 113, 7);
+
+  RemoteSpace_t::fence();
+}
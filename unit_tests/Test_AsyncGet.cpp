@@ -0,0 +1,90 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_get_async(int size, int num_reads) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using Handle_t     = Kokkos::Experimental::RemoteSpaces::AsyncValue<Data_t>;
+  using Kokkos::Experimental::RemoteSpaces::get_async;
+  using Kokkos::Experimental::RemoteSpaces::wait;
+  using Kokkos::Experimental::RemoteSpaces::wait_all;
+
+  RemoteView_t v_R("RemoteView", num_ranks, size);
+  Kokkos::View<Data_t **, RemoteSpace_t, Kokkos::MemoryTraits<Kokkos::Atomic>>
+      v_A("AtomicView", num_ranks, 1);
+
+  Kokkos::parallel_for(
+      "Init", size, KOKKOS_LAMBDA(const int i) {
+        v_R(my_rank, i) = (Data_t)my_rank * size + i;
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  // Single reads
+  int next_rank = (my_rank + 1) % num_ranks;
+  auto h        = get_async(v_R, next_rank, size - 1);
+  ASSERT_EQ(wait(h), (Data_t)next_rank * size + size - 1);
+  ASSERT_FALSE(h.pending());
+
+  // Many reads in flight, completed together
+  std::vector<Handle_t> handles(num_reads);
+  for (int k = 0; k < num_reads; ++k)
+    handles[k].start(v_R, k % num_ranks, (k * 7919) % size);
+  wait_all(handles.data(), handles.size());
+
+  for (int k = 0; k < num_reads; ++k)
+    ASSERT_EQ(handles[k].wait(),
+              (Data_t)(k % num_ranks) * size + (k * 7919) % size);
+
+  // Variadic completion, handles reused
+  Handle_t a, b;
+  a.start(v_R, 0, 0);
+  b.start(v_R, num_ranks - 1, size / 2);
+  wait_all(a, b);
+  ASSERT_EQ(a.wait(), (Data_t)0);
+  ASSERT_EQ(b.wait(), (Data_t)(num_ranks - 1) * size + size / 2);
+
+  RemoteSpace_t::fence();
+
+  // Reads observe the calling thread's own stores and atomic adds
+  v_R(next_rank, 0) = (Data_t)-1;
+  auto s = get_async(v_R, next_rank, 0);
+  ASSERT_EQ(wait(s), (Data_t)-1);
+
+  v_A(next_rank, 0).add((Data_t)3);
+  auto t = get_async(v_A, next_rank, 0);
+  ASSERT_EQ(wait(t), (Data_t)3);
+
+  RemoteSpace_t::fence();
+}
+
+TEST(TEST_CATEGORY, test_get_async) {
+  test_get_async<int>(1, 1);
+  test_get_async<int64_t>(4096, 1000);
+  test_get_async<double>(10000, 5000);
+}
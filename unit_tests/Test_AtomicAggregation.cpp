@@ -0,0 +1,118 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+/* Histogram: every PE adds to pseudo-random bins on all PEs, many of them
+ * repeatedly, so inc() and add() to the same element are merged */
+template <class Data_t>
+void test_atomic_histogram(int num_bins, int num_updates) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t =
+      Kokkos::View<Data_t **, RemoteSpace_t,
+                   Kokkos::MemoryTraits<Kokkos::Atomic>>;
+  using HostSpace_t = typename RemoteView_t::HostMirror;
+
+  RemoteView_t v_R("RemoteView", num_ranks, num_bins);
+  HostSpace_t v_H("HostView", v_R.extent(0), num_bins);
+
+  Kokkos::parallel_for(
+      "Histogram", num_updates, KOKKOS_LAMBDA(const int u) {
+        int pe  = (u + my_rank) % num_ranks;
+        int bin = (int64_t(u) * 7919) % num_bins;
+        if (u % 3 == 0)
+          v_R(pe, bin).inc();
+        else if (u % 3 == 1)
+          v_R(pe, bin).add((Data_t)2);
+        else
+          v_R(pe, bin) += (Data_t)3;
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  Kokkos::deep_copy(v_H, v_R);
+
+  // Every PE issues the same updates, shifted by its rank
+  std::vector<Data_t> expected(num_bins, 0);
+  for (int src = 0; src < num_ranks; ++src)
+    for (int u = 0; u < num_updates; ++u)
+      if ((u + src) % num_ranks == my_rank)
+        expected[(int64_t(u) * 7919) % num_bins] += u % 3 + 1;
+
+  for (int bin = 0; bin < num_bins; ++bin)
+    ASSERT_EQ(v_H(0, bin), expected[bin]);
+}
+
+/* Operators returning a value observe the increments and decrements the
+ * calling thread has buffered */
+template <class Data_t>
+void test_atomic_return_values(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t =
+      Kokkos::View<Data_t **, RemoteSpace_t,
+                   Kokkos::MemoryTraits<Kokkos::Atomic>>;
+  using HostSpace_t = typename RemoteView_t::HostMirror;
+
+  RemoteView_t v_R("RemoteView", num_ranks, size);
+  HostSpace_t v_H("HostView", v_R.extent(0), size);
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  int errors    = 0;
+
+  Kokkos::parallel_reduce(
+      "ReturnValues", size,
+      KOKKOS_LAMBDA(const int i, int &err) {
+        v_R(next_rank, i).inc();
+        v_R(next_rank, i).inc();
+        if (v_R(next_rank, i)++ != (Data_t)2) ++err;
+        v_R(next_rank, i).dec();
+        if (Data_t(v_R(next_rank, i)) != (Data_t)2) ++err;
+        v_R(next_rank, i).inc();
+      },
+      errors);
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  ASSERT_EQ(errors, 0);
+
+  Kokkos::deep_copy(v_H, v_R);
+
+  for (int i = 0; i < size; ++i) ASSERT_EQ(v_H(0, i), (Data_t)3);
+}
+
+TEST(TEST_CATEGORY, test_atomic_aggregation) {
+  test_atomic_histogram<int>(1, 1);
+  test_atomic_histogram<int>(17, 100000);
+  test_atomic_histogram<int64_t>(4096, 100000);
+  test_atomic_histogram<double>(10000, 50000);
+  test_atomic_return_values<int>(1);
+  test_atomic_return_values<int>(10000);
+  test_atomic_return_values<int64_t>(4097);
+}
@@ -0,0 +1,78 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_comm_plan(int size, int steps) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using HostView_t   = Kokkos::View<Data_t *, Kokkos::HostSpace>;
+  using Kokkos::Experimental::get_range;
+
+  RemoteView_t v_R("RemoteView", num_ranks * size);
+  RemoteView_t v_R_put("RemoteView", num_ranks * size);
+  HostView_t v_H("HostView", size);
+  HostView_t v_H_get("HostView", size);
+  HostView_t v_H_across("HostView", size);
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  int prev_rank = (my_rank + num_ranks - 1) % num_ranks;
+
+  Kokkos::Experimental::RemoteSpaces::CommPlan plan;
+  plan.record_get(v_H_get,
+                  Kokkos::subview(v_R, get_range(num_ranks * size, next_rank)));
+  plan.record_put(
+      Kokkos::subview(v_R_put, get_range(num_ranks * size, prev_rank)), v_H);
+  // Range spanning the partitions of PE 0 and PE 1
+  if (num_ranks > 1)
+    plan.record_get(v_H_across, Kokkos::subview(v_R, std::make_pair(
+                                                   size / 2, size / 2 + size)));
+
+  for (int step = 0; step < steps; ++step) {
+    for (int i = 0; i < size; ++i) v_H(i) = Data_t(step + my_rank * size + i);
+    Kokkos::deep_copy(v_R, v_H);
+    RemoteSpace_t::fence();
+
+    plan.execute();
+    RemoteSpace_t::fence();
+
+    typename RemoteView_t::HostMirror v_H_put("HostView", size);
+    Kokkos::deep_copy(v_H_put, v_R_put);
+    for (int i = 0; i < size; ++i) {
+      ASSERT_EQ(v_H_get(i), Data_t(step + next_rank * size + i));
+      ASSERT_EQ(v_H_put(i), Data_t(step + next_rank * size + i));
+      if (num_ranks > 1)
+        ASSERT_EQ(v_H_across(i), Data_t(step + size / 2 + i));
+    }
+  }
+}
+
+TEST(TEST_CATEGORY, test_comm_plan) {
+  test_comm_plan<int>(128, 3);
+  test_comm_plan<double>(1000, 4);
+
+  RemoteSpace_t::fence();
+}
@@ -0,0 +1,69 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_const_view_reads(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t      = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using ConstRemoteView_t = Kokkos::View<const Data_t **, RemoteSpace_t>;
+
+  RemoteView_t v_R("RemoteView", num_ranks, size);
+  ConstRemoteView_t v_C = v_R;
+
+  int next_rank = (my_rank + 1) % num_ranks;
+
+  for (int iter = 1; iter <= 2; iter++) {
+    Kokkos::parallel_for(
+        "Init", size,
+        KOKKOS_LAMBDA(const int i) { v_R(my_rank, i) = (Data_t)iter * i; });
+
+    Kokkos::fence();
+    RemoteSpace_t::fence();
+
+    // Every element of the next rank is read several times
+    Data_t check(0), ref(0);
+    Kokkos::parallel_reduce(
+        "ConstRead", 4 * size,
+        KOKKOS_LAMBDA(const int i, Data_t &sum) {
+          Data_t val = v_C(next_rank, i % size);
+          sum += val;
+        },
+        check);
+    for (int i = 0; i < size; i++) ref += 4 * (Data_t)iter * i;
+
+    // Values read in the first iteration must not survive the fence
+    ASSERT_EQ(check, ref);
+    RemoteSpace_t::fence();
+  }
+}
+
+TEST(TEST_CATEGORY, test_const_view_reads) {
+  test_const_view_reads<int>(1);
+  test_const_view_reads<int>(1023);
+  test_const_view_reads<int64_t>(4096);
+  test_const_view_reads<double>(10000);
+}
@@ -195,6 +195,69 @@ void test_deepcopy(
   Kokkos::fence();
 }
 
+// Copies spanning several chunks of the threaded host copy
+template <class Data_t>
+void test_deepcopy_chunked(int i1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using ViewHost_t   = typename ViewRemote_t::HostMirror;
+
+  ViewHost_t v_H("HostView", 1, i1);
+  ViewHost_t v_H_back("HostView", 1, i1);
+  ViewRemote_t v_R = ViewRemote_t("RemoteView", num_ranks, i1);
+
+  for (int i = 0; i < i1; ++i) v_H(0, i) = Data_t(my_rank + i);
+
+  Kokkos::DefaultHostExecutionSpace exec;
+  Kokkos::deep_copy(exec, v_R, v_H);
+  exec.fence();
+  RemoteSpace_t::fence();
+  Kokkos::deep_copy(v_H_back, v_R);
+
+  for (int i = 0; i < i1; ++i) ASSERT_EQ(v_H_back(0, i), Data_t(my_rank + i));
+}
+
+// Scalar fill of the local partition and of the next rank's partition
+template <class Data_t>
+void test_deepcopy_fill(int i0, int i1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using ViewHost_t   = typename ViewRemote_t::HostMirror;
+
+  ViewRemote_t v_R = ViewRemote_t("RemoteView", num_ranks * i0, i1);
+  ViewHost_t v_H("HostView", i0, i1);
+
+  Kokkos::deep_copy(v_R, Data_t(0x123));
+  RemoteSpace_t::fence();
+  Kokkos::deep_copy(v_H, v_R);
+  for (int i = 0; i < i0; ++i)
+    for (int j = 0; j < i1; ++j) ASSERT_EQ(v_H(i, j), Data_t(0x123));
+
+  Kokkos::deep_copy(v_R, Data_t(0));
+  RemoteSpace_t::fence();
+  Kokkos::deep_copy(v_H, v_R);
+  for (int i = 0; i < i0; ++i)
+    for (int j = 0; j < i1; ++j) ASSERT_EQ(v_H(i, j), Data_t(0));
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  auto v_next   = Kokkos::subview(
+      v_R, Kokkos::Experimental::get_range(num_ranks * i0, next_rank),
+      Kokkos::ALL);
+  Kokkos::deep_copy(v_next, Data_t(0x42));
+  RemoteSpace_t::fence();
+  Kokkos::deep_copy(v_H, v_R);
+  for (int i = 0; i < i0; ++i)
+    for (int j = 0; j < i1; ++j) ASSERT_EQ(v_H(i, j), Data_t(0x42));
+}
+
 #define GENBLOCK1(TYPE)                                    \
   test_deepcopy<TYPE, RemoteSpace_t, Kokkos::HostSpace>(); \
   test_deepcopy<TYPE, Kokkos::HostSpace, RemoteSpace_t>();
@@ -220,6 +283,12 @@ TEST(TEST_CATEGORY, test_deepcopy) {
   GENBLOCK3(int)
   GENBLOCK3(float)
   GENBLOCK3(double)
+  // Fill
+  test_deepcopy_fill<int>(100, 200);
+  test_deepcopy_fill<double>((1 << 20) / 7, 7);
+  // Multi-chunk
+  test_deepcopy_chunked<int>((3 << 20) / sizeof(int) + 7);
+  test_deepcopy_chunked<double>((3 << 20) / sizeof(double) + 7);
 
   RemoteSpace_t::fence();
 }
@@ -0,0 +1,88 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_deep_copy_async(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using HostView_t   = Kokkos::View<Data_t *, Kokkos::HostSpace>;
+  using Kokkos::Experimental::get_range;
+  using Kokkos::Experimental::RemoteSpaces::deep_copy_async;
+
+  Kokkos::DefaultHostExecutionSpace exec;
+
+  RemoteView_t v_R("RemoteView", num_ranks * size);
+  RemoteView_t v_R_put("RemoteView", num_ranks * size);
+  HostView_t v_H("HostView", size);
+  HostView_t v_H_get("HostView", size);
+
+  for (int i = 0; i < size; ++i) v_H(i) = Data_t(my_rank * size + i);
+
+  // Host to local partition
+  auto h = deep_copy_async(exec, v_R, v_H);
+  h.wait();
+  RemoteSpace_t::fence();
+
+  // Remote partition to host
+  int next_rank = (my_rank + 1) % num_ranks;
+  auto v_next   = Kokkos::subview(v_R, get_range(num_ranks * size, next_rank));
+  auto h_get    = deep_copy_async(exec, v_H_get, v_next);
+
+  // Host to remote partition
+  int prev_rank = (my_rank + num_ranks - 1) % num_ranks;
+  auto v_prev =
+      Kokkos::subview(v_R_put, get_range(num_ranks * size, prev_rank));
+  auto h_put = deep_copy_async(exec, v_prev, v_H);
+
+  h_get.wait();
+  h_put.wait();
+  RemoteSpace_t::fence();
+
+  for (int i = 0; i < size; ++i)
+    ASSERT_EQ(v_H_get(i), Data_t(next_rank * size + i));
+
+  Kokkos::deep_copy(v_H_get, v_R_put);
+  for (int i = 0; i < size; ++i)
+    ASSERT_EQ(v_H_get(i), Data_t(((my_rank + 1) % num_ranks) * size + i));
+
+  // Range spanning the partitions of PE 0 and PE 1
+  if (num_ranks > 1) {
+    auto range    = Kokkos::pair(size / 2, size / 2 + size);
+    auto v_across = Kokkos::subview(v_R, range);
+    deep_copy_async(exec, v_H_get, v_across).wait();
+    for (int i = 0; i < size; ++i)
+      ASSERT_EQ(v_H_get(i), Data_t(size / 2 + i));
+  }
+
+  RemoteSpace_t::fence();
+}
+
+TEST(TEST_CATEGORY, test_deep_copy_async) {
+  test_deep_copy_async<int>(1);
+  test_deep_copy_async<int64_t>(4096);
+  test_deep_copy_async<double>(10000);
+}
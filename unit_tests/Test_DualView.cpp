@@ -0,0 +1,142 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_remote_dual_view(int size, int cols) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using DualView_t =
+      Kokkos::Experimental::RemoteSpaces::RemoteDualView<RemoteView_t>;
+  using range_type = typename DualView_t::range_type;
+
+  DualView_t dv("DualView", num_ranks * size, cols);
+  auto v_R = dv.view_remote();
+  auto v_L = dv.view_local();
+  auto v_H = dv.view_host();
+
+  ASSERT_EQ(v_L.data(), v_R.data());
+  ASSERT_EQ(v_L.extent(0), size_t(size));
+  ASSERT_EQ(v_H.extent(1), size_t(cols));
+
+  // Host to partition, only the flagged range is pushed
+  Kokkos::deep_copy(v_H, (Data_t)1);
+  dv.modify_host();
+  dv.sync_remote();
+  ASSERT_FALSE(dv.need_sync_remote());
+
+  for (int i = 0; i < size; ++i)
+    for (int j = 0; j < cols; ++j) v_H(i, j) = (Data_t)2;
+  dv.modify_host(range_type(size / 2, size));
+  dv.sync_remote();
+
+  RemoteSpace_t::fence();
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  Kokkos::parallel_for(
+      "Check", size, KOKKOS_LAMBDA(const int i) {
+        Data_t expected = i < size / 2 ? (Data_t)1 : (Data_t)2;
+        for (int j = 0; j < cols; ++j)
+          if (v_R(next_rank * size + i, j) != expected)
+            Kokkos::abort("Unexpected value after sync_remote");
+      });
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  // Remote writes into the partition, only the flagged range is pulled
+  int prev_rank = (my_rank + num_ranks - 1) % num_ranks;
+  Kokkos::parallel_for(
+      "Write", size, KOKKOS_LAMBDA(const int i) {
+        for (int j = 0; j < cols; ++j)
+          v_R(prev_rank * size + i, j) = (Data_t)(i + 3);
+      });
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  dv.modify_local(range_type(0, size / 2));
+  ASSERT_TRUE(dv.need_sync_local());
+  dv.sync_local();
+  ASSERT_FALSE(dv.need_sync_local());
+
+  for (int i = 0; i < size; ++i)
+    for (int j = 0; j < cols; ++j)
+      ASSERT_EQ(v_H(i, j), i < size / 2 ? (Data_t)(i + 3) : (Data_t)2);
+
+  RemoteSpace_t::fence();
+}
+
+/* Partitioned layouts own one dim0 row per PE */
+template <class Data_t, class Layout>
+void test_remote_dual_view_partitioned(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t **, Layout, RemoteSpace_t>;
+  using DualView_t =
+      Kokkos::Experimental::RemoteSpaces::RemoteDualView<RemoteView_t>;
+
+  DualView_t dv("DualView", num_ranks, size);
+  auto v_R = dv.view_remote();
+  auto v_L = dv.view_local();
+  auto v_H = dv.view_host();
+
+  ASSERT_EQ(v_L.data(), v_R.data());
+  ASSERT_EQ(v_L.extent(0), size_t(1));
+  ASSERT_EQ(v_H.extent(0), size_t(1));
+  ASSERT_EQ(v_H.extent(1), size_t(size));
+
+  for (int j = 0; j < size; ++j) v_H(0, j) = (Data_t)(my_rank * size + j);
+  dv.modify_host();
+  dv.sync_remote();
+
+  RemoteSpace_t::fence();
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  int errors    = 0;
+  Kokkos::parallel_reduce(
+      "Check", size,
+      KOKKOS_LAMBDA(const int j, int &err) {
+        if (v_R(next_rank, j) != (Data_t)(next_rank * size + j)) ++err;
+      },
+      errors);
+  Kokkos::fence();
+  ASSERT_EQ(errors, 0);
+
+  RemoteSpace_t::fence();
+}
+
+TEST(TEST_CATEGORY, test_remote_dual_view) {
+  test_remote_dual_view<int>(1, 1);
+  test_remote_dual_view<int64_t>(128, 3);
+  test_remote_dual_view<double>(1024, 17);
+  test_remote_dual_view_partitioned<int, Kokkos::PartitionedLayoutRight>(1);
+  test_remote_dual_view_partitioned<double, Kokkos::PartitionedLayoutRight>(
+      1000);
+  test_remote_dual_view_partitioned<int64_t, Kokkos::PartitionedLayoutLeft>(
+      257);
+}
@@ -0,0 +1,99 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#ifdef KRS_ENABLE_MPISPACE
+
+using RemoteSpace_t = Kokkos::Experimental::MPISpace;
+
+template <class Data_t>
+void test_fenced_allocation(int size, int steps) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using HostView_t   = Kokkos::View<Data_t *, Kokkos::HostSpace>;
+  using Kokkos::Experimental::get_range;
+
+  RemoteSpace_t space;
+  space.impl_set_allocation_mode(Kokkos::Experimental::Fenced);
+  RemoteView_t v_R(Kokkos::view_alloc(space, "RemoteView"), num_ranks * size);
+  RemoteView_t v_R_put(Kokkos::view_alloc(space, "RemoteView"),
+                       num_ranks * size);
+  HostView_t v_H("HostView", size);
+  HostView_t v_H_get("HostView", size);
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  int prev_rank = (my_rank + num_ranks - 1) % num_ranks;
+
+  Kokkos::Experimental::RemoteSpaces::CommPlan plan;
+  plan.record_get(v_H_get,
+                  Kokkos::subview(v_R, get_range(num_ranks * size, next_rank)));
+  plan.record_put(
+      Kokkos::subview(v_R_put, get_range(num_ranks * size, prev_rank)), v_H);
+
+  for (int step = 0; step < steps; ++step) {
+    for (int i = 0; i < size; ++i) {
+      v_R(my_rank * size + i) = Data_t(step + my_rank * size + i);
+      v_H(i)                  = Data_t(step + my_rank * size + i);
+    }
+    RemoteSpace_t::fence();
+
+    // Transfers complete at the fence closing the epoch
+    plan.execute();
+    RemoteSpace_t::fence(MPI_MODE_NOSTORE);
+
+    for (int i = 0; i < size; ++i) {
+      ASSERT_EQ(v_H_get(i), Data_t(step + next_rank * size + i));
+      ASSERT_EQ(v_R_put(my_rank * size + i),
+                Data_t(step + next_rank * size + i));
+    }
+    RemoteSpace_t::fence(MPI_MODE_NOSTORE | MPI_MODE_NOPUT);
+  }
+
+  // Elements of other PEs are accessed through a passive-target window
+  for (int i = 0; i < size; ++i)
+    v_R(next_rank * size + i) = Data_t(my_rank * size + i);
+  RemoteSpace_t::fence();
+  for (int i = 0; i < size; ++i) {
+    ASSERT_EQ(Data_t(v_R(next_rank * size + i)), Data_t(my_rank * size + i));
+    ASSERT_EQ(Data_t(v_R(my_rank * size + i)), Data_t(prev_rank * size + i));
+  }
+  RemoteSpace_t::fence();
+
+  // Split-phase reads need request completion
+  using Kokkos::Experimental::RemoteSpaces::get_async;
+  using Kokkos::Experimental::RemoteSpaces::prefetch;
+  EXPECT_THROW(get_async(v_R, 0), std::runtime_error);
+  EXPECT_THROW(prefetch(v_R, Kokkos::make_pair(size_t(0), size_t(num_ranks))),
+               std::runtime_error);
+}
+
+TEST(TEST_CATEGORY, test_fenced_allocation) {
+  test_fenced_allocation<int>(128, 3);
+  test_fenced_allocation<double>(1000, 4);
+
+  RemoteSpace_t::fence();
+}
+
+#endif
@@ -0,0 +1,77 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_gather_plan(int size, int num_indices) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using IndexView_t  = Kokkos::View<int64_t *, Kokkos::HostSpace>;
+  using Plan_t = Kokkos::Experimental::RemoteSpaces::GatherPlan<RemoteView_t>;
+
+  int total = num_ranks * size;
+  RemoteView_t v_R("RemoteView", total);
+
+  // Irregular pattern with repeated indices on every PE
+  IndexView_t indices("Indices", num_indices);
+  for (int k = 0; k < num_indices; ++k)
+    indices(k) = (int64_t(k) * 7919 + my_rank) % (total / 2 + 1);
+
+  Plan_t plan(v_R, indices);
+  ASSERT_LE(plan.buffer_size(), size_t(num_indices));
+
+  auto sub = Kokkos::subview(v_R, Kokkos::make_pair(1, total));
+  using SubPlan_t =
+      Kokkos::Experimental::RemoteSpaces::GatherPlan<decltype(sub)>;
+  EXPECT_THROW((SubPlan_t(sub, indices)), std::runtime_error);
+
+  auto buffer      = plan.create_buffer();
+  auto remap       = plan.remapped_indices();
+  auto local_range = Kokkos::Experimental::get_local_range(total);
+
+  for (int iter = 1; iter <= 2; iter++) {
+    Kokkos::parallel_for(
+        "Init", Kokkos::RangePolicy<>(local_range.first, local_range.second),
+        KOKKOS_LAMBDA(const int i) { v_R(i) = (Data_t)iter * i; });
+
+    Kokkos::fence();
+    RemoteSpace_t::fence();
+
+    plan.execute(v_R, buffer);
+
+    for (int k = 0; k < num_indices; ++k)
+      ASSERT_EQ(buffer(remap(k)), (Data_t)iter * indices(k));
+
+    RemoteSpace_t::fence();
+  }
+}
+
+TEST(TEST_CATEGORY, test_gather_plan) {
+  test_gather_plan<int>(1, 1);
+  test_gather_plan<int>(1023, 4096);
+  test_gather_plan<int64_t>(4096, 100);
+  test_gather_plan<double>(10000, 50000);
+}
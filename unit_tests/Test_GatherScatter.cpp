@@ -0,0 +1,101 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_remote_gather_scatter(int size, int num_indices) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using IndexView_t  = Kokkos::View<int64_t *, Kokkos::HostSpace>;
+  using LocalView_t  = Kokkos::View<Data_t *, Kokkos::HostSpace>;
+  using Kokkos::Experimental::RemoteSpaces::remote_gather;
+  using Kokkos::Experimental::RemoteSpaces::remote_scatter;
+  using Kokkos::Experimental::RemoteSpaces::ScatterOp;
+
+  int total = num_ranks * size;
+  RemoteView_t v_R("RemoteView", total);
+  IndexView_t indices("Indices", num_indices);
+  LocalView_t values("Values", num_indices);
+  auto local_range = Kokkos::Experimental::get_local_range(total);
+
+  // Gather an irregular pattern with repeated indices
+  for (int k = 0; k < num_indices; ++k)
+    indices(k) = (int64_t(k) * 7919 + my_rank) % total;
+
+  Kokkos::parallel_for(
+      "Init", Kokkos::RangePolicy<>(local_range.first, local_range.second),
+      KOKKOS_LAMBDA(const int i) { v_R(i) = (Data_t)i; });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  remote_gather(values, v_R, indices);
+  for (int k = 0; k < num_indices; ++k)
+    ASSERT_EQ(values(k), (Data_t)indices(k));
+
+  auto sub = Kokkos::subview(v_R, Kokkos::make_pair(1, total));
+  EXPECT_THROW(remote_gather(values, sub, indices), std::runtime_error);
+  EXPECT_THROW(remote_scatter(sub, values, indices), std::runtime_error);
+
+  RemoteSpace_t::fence();
+
+  // Every PE overwrites (Replace) or adds to (Add) its right neighbor's
+  // block; repeated indices accumulate with Add
+  int neighbor = (my_rank + 1) % num_ranks;
+  for (int k = 0; k < num_indices; ++k) {
+    indices(k) = int64_t(neighbor) * size + k % size;
+    values(k)  = (Data_t)1;
+  }
+
+  IndexView_t block_indices("BlockIndices", size);
+  LocalView_t block_values("BlockValues", size);
+  for (int j = 0; j < size; ++j)
+    block_indices(j) = int64_t(my_rank) * size + j;
+
+  for (auto op : {ScatterOp::Replace, ScatterOp::Add}) {
+    remote_scatter(v_R, values, indices, op);
+    RemoteSpace_t::fence();
+
+    remote_gather(block_values, v_R, block_indices);
+    for (int j = 0; j < size; ++j) {
+      Data_t expected = (Data_t)(my_rank * size + j);
+      if (j < num_indices) expected = (Data_t)1;
+      // Replace set the element to 1, Add contributes once per occurrence
+      if (op == ScatterOp::Add && j < num_indices)
+        expected += (Data_t)((num_indices - 1 - j) / size + 1);
+      ASSERT_EQ(block_values(j), expected);
+    }
+
+    RemoteSpace_t::fence();
+  }
+}
+
+TEST(TEST_CATEGORY, test_remote_gather_scatter) {
+  test_remote_gather_scatter<int>(1, 1);
+  test_remote_gather_scatter<int>(1023, 4096);
+  test_remote_gather_scatter<int64_t>(4096, 100);
+  test_remote_gather_scatter<double>(10000, 50000);
+}
@@ -0,0 +1,68 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_ghosted_view(int dim0, int dim1, int ghosts) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t =
+      Kokkos::View<Data_t **, Kokkos::LayoutRight, RemoteSpace_t>;
+  using GhostedView_t =
+      Kokkos::Experimental::RemoteSpaces::GhostedView<RemoteView_t>;
+
+  GhostedView_t v("GhostedView", ghosts, dim0, dim1);
+  auto v_L     = v.view_local();
+  auto owned   = v.owned();
+  size_t first = v.global_begin();
+
+  for (size_t i = 0; i < v_L.extent(0); ++i)
+    for (int j = 0; j < dim1; ++j) v_L(i, j) = Data_t(-1);
+  for (size_t i = owned.first; i < owned.second; ++i)
+    for (int j = 0; j < dim1; ++j)
+      v_L(i, j) = Data_t((first + i - ghosts) * dim1 + j);
+
+  v.update_halos();
+
+  // Ghost plane g mirrors global plane first - ghosts + g and first + n + g
+  size_t n = owned.second - owned.first;
+  for (int g = 0; g < ghosts; ++g)
+    for (int j = 0; j < dim1; ++j) {
+      if (my_rank > 0)
+        ASSERT_EQ(v_L(g, j), Data_t((first - ghosts + g) * dim1 + j));
+      else
+        ASSERT_EQ(v_L(g, j), Data_t(-1));
+      if (my_rank + 1 < num_ranks && first + n + g < dim0)
+        ASSERT_EQ(v_L(owned.second + g, j), Data_t((first + n + g) * dim1 + j));
+    }
+}
+
+TEST(TEST_CATEGORY, test_ghosted_view) {
+  test_ghosted_view<int>(64, 9, 1);
+  test_ghosted_view<double>(96, 33, 2);
+  test_ghosted_view<double>(101, 17, 3);
+
+  RemoteSpace_t::fence();
+}
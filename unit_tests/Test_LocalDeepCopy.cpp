@@ -1044,3 +1044,199 @@ TEST(TEST_CATEGORY, test_localdeepcopy) {
 
   RemoteSpace_t::fence();
 }
+
+template <class Data_t, int is_enabled_team>
+void test_localdeepcopy_multi_pe(int block) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  if (num_ranks < 2) return;
+
+  using ViewRemote_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using ViewHost_t   = typename ViewRemote_t::HostMirror;
+  using TeamPolicy_t = Kokkos::TeamPolicy<>;
+
+  ViewRemote_t v_R     = ViewRemote_t("RemoteView", num_ranks * block);
+  ViewRemote_t v_R_cpy = ViewRemote_t("RemoteView", num_ranks * block);
+  ViewHost_t v_H("HostView", v_R.extent(0));
+
+  Kokkos::parallel_for(
+      "Init", block, KOKKOS_LAMBDA(const int i) {
+        v_R(my_rank * block + i) = my_rank * block + i + 1;
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  // Range crossing the partition boundary between PE 0 and PE 1, copied by
+  // the last PE (holding none of it if there are more than two PEs)
+  auto range  = Kokkos::pair(block / 2, block / 2 + block);
+  auto v_src  = Kokkos::subview(v_R, range);
+  auto v_dst  = Kokkos::subview(v_R_cpy, range);
+  bool copier = my_rank == num_ranks - 1;
+
+  // Three teams give one team a range crossing the partition boundary
+  int league_size = is_enabled_team == with_team ? 3 : 1;
+
+  if (copier) {
+    Kokkos::parallel_for(
+        "Team", TeamPolicy_t(league_size, 1),
+        KOKKOS_LAMBDA(typename TeamPolicy_t::member_type team) {
+          if constexpr (is_enabled_team == with_team) {
+            Kokkos::Experimental::RemoteSpaces::local_deep_copy(team, v_dst,
+                                                                v_src);
+          } else {
+            Kokkos::single(Kokkos::PerTeam(team), [&]() {
+              Kokkos::Experimental::RemoteSpaces::local_deep_copy(v_dst, v_src);
+            });
+          }
+        });
+  }
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  Kokkos::deep_copy(v_H, v_R_cpy);
+  for (int i = 0; i < block; ++i) {
+    int g = my_rank * block + i;
+    if (g >= range.first && g < range.second)
+      ASSERT_EQ(Data_t(g + 1), v_H(i));
+    else
+      ASSERT_EQ(Data_t(0), v_H(i));
+  }
+}
+
+TEST(TEST_CATEGORY, test_localdeepcopy_multi_pe) {
+  test_localdeepcopy_multi_pe<int, without_team>(16);
+  test_localdeepcopy_multi_pe<int, with_team>(16);
+  test_localdeepcopy_multi_pe<double, without_team>(2048);
+  test_localdeepcopy_multi_pe<double, with_team>(2048);
+
+  RemoteSpace_t::fence();
+}
+
+template <class Data_t>
+void test_localdeepcopy_remote_to_remote(int block, bool with_scratch) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  // The copier must hold neither side
+  if (num_ranks < 3) return;
+
+  using ViewRemote_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using ViewHost_t   = typename ViewRemote_t::HostMirror;
+  using TeamPolicy_t = Kokkos::TeamPolicy<>;
+
+  ViewRemote_t v_R     = ViewRemote_t("RemoteView", num_ranks * block);
+  ViewRemote_t v_R_cpy = ViewRemote_t("RemoteView", num_ranks * block);
+  ViewHost_t v_H("HostView", v_R.extent(0));
+
+  Kokkos::parallel_for(
+      "Init", block, KOKKOS_LAMBDA(const int i) {
+        v_R(my_rank * block + i) = my_rank * block + i + 1;
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  // Copy the next PE's partition to the partition of the PE after it
+  int src_rank = (my_rank + 1) % num_ranks;
+  int dst_rank = (my_rank + 2) % num_ranks;
+  auto v_src   = Kokkos::subview(
+      v_R, Kokkos::Experimental::get_range(num_ranks * block, src_rank));
+  auto v_dst = Kokkos::subview(
+      v_R_cpy, Kokkos::Experimental::get_range(num_ranks * block, dst_rank));
+
+  // Teams stage through scratch if the launch reserves it
+  TeamPolicy_t policy(3, 1);
+  if (with_scratch)
+    policy.set_scratch_size(
+        0, Kokkos::PerTeam(KRS_LOCAL_DEEP_COPY_STAGING_BYTES));
+
+  Kokkos::parallel_for(
+      "Team", policy, KOKKOS_LAMBDA(typename TeamPolicy_t::member_type team) {
+        Kokkos::Experimental::RemoteSpaces::local_deep_copy(team, v_dst, v_src);
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  // This PE's partition holds a copy of the previous PE's
+  int prev_rank = (my_rank + num_ranks - 1) % num_ranks;
+  Kokkos::deep_copy(v_H, v_R_cpy);
+  for (int i = 0; i < block; ++i)
+    ASSERT_EQ(Data_t(prev_rank * block + i + 1), v_H(i));
+}
+
+TEST(TEST_CATEGORY, test_localdeepcopy_remote_to_remote) {
+  test_localdeepcopy_remote_to_remote<int>(16, false);
+  test_localdeepcopy_remote_to_remote<int>(16, true);
+  test_localdeepcopy_remote_to_remote<double>(2048, false);
+  test_localdeepcopy_remote_to_remote<double>(2048, true);
+
+  RemoteSpace_t::fence();
+}
+
+template <class Data_t, class Layout_t>
+void test_localdeepcopy_team_slabs(int n0, int i1, int i2) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_t = Kokkos::View<Data_t ***, Layout_t, RemoteSpace_t>;
+  using ViewHost_t   = typename ViewRemote_t::HostMirror;
+  using TeamPolicy_t = Kokkos::TeamPolicy<>;
+
+  ViewRemote_t v_R     = ViewRemote_t("RemoteView", num_ranks * n0, i1, i2);
+  ViewRemote_t v_R_cpy = ViewRemote_t("RemoteView", num_ranks * n0, i1, i2);
+  ViewHost_t v_H("HostView", n0, i1, i2);
+
+  auto value = [&](int pe, int i, int j, int k) {
+    return Data_t(((pe * n0 + i) * i1 + j) * i2 + k + 1);
+  };
+
+  for (int i = 0; i < n0; ++i)
+    for (int j = 0; j < i1; ++j)
+      for (int k = 0; k < i2; ++k) v_H(i, j, k) = value(my_rank, i, j, k);
+
+  Kokkos::deep_copy(v_R, v_H);
+  RemoteSpace_t::fence();
+
+  // Fetch the next PE's partition, split in dim0 slabs over several teams
+  int next_rank = (my_rank + 1) % num_ranks;
+  auto v_src    = Kokkos::subview(
+      v_R, Kokkos::Experimental::get_range(num_ranks * n0, next_rank),
+      Kokkos::ALL, Kokkos::ALL);
+  auto v_dst = Kokkos::subview(
+      v_R_cpy, Kokkos::Experimental::get_local_range(num_ranks * n0),
+      Kokkos::ALL, Kokkos::ALL);
+
+  Kokkos::parallel_for(
+      "Team", TeamPolicy_t(3, Kokkos::AUTO),
+      KOKKOS_LAMBDA(typename TeamPolicy_t::member_type team) {
+        Kokkos::Experimental::RemoteSpaces::local_deep_copy(team, v_dst, v_src);
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  Kokkos::deep_copy(v_H, v_R_cpy);
+  for (int i = 0; i < n0; ++i)
+    for (int j = 0; j < i1; ++j)
+      for (int k = 0; k < i2; ++k)
+        ASSERT_EQ(value(next_rank, i, j, k), v_H(i, j, k));
+}
+
+TEST(TEST_CATEGORY, test_localdeepcopy_team_slabs) {
+  test_localdeepcopy_team_slabs<int, Kokkos::LayoutRight>(10, 4, 3);
+  test_localdeepcopy_team_slabs<int, Kokkos::LayoutLeft>(10, 4, 3);
+  test_localdeepcopy_team_slabs<double, Kokkos::LayoutRight>(7, 5, 6);
+  test_localdeepcopy_team_slabs<double, Kokkos::LayoutLeft>(7, 5, 6);
+
+  RemoteSpace_t::fence();
+}
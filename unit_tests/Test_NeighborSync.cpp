@@ -0,0 +1,85 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_neighbor_sync(int size, int steps) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using HostView_t   = Kokkos::View<Data_t *, Kokkos::HostSpace>;
+
+  // Every partition holds a block received from the left and one received
+  // from the right neighbor
+  const int n    = 2 * size;
+  int left_rank  = (my_rank + num_ranks - 1) % num_ranks;
+  int right_rank = (my_rank + 1) % num_ranks;
+
+  RemoteView_t v_R("RemoteView", num_ranks * n);
+  HostView_t v_H("HostView", size);
+
+  auto block = [&](int rank, int k) {
+    return Kokkos::subview(
+        v_R, std::make_pair(rank * n + k * size, rank * n + (k + 1) * size));
+  };
+
+  {
+    Kokkos::Experimental::RemoteSpaces::NeighborSync sync(
+        v_R, {left_rank, right_rank});
+    ASSERT_LE(sync.neighbors().size(), 2u);
+
+    Kokkos::Experimental::RemoteSpaces::CommPlan plan;
+    plan.record_put(block(right_rank, 0), v_H);
+    plan.record_put(block(left_rank, 1), v_H);
+
+    for (int step = 0; step < steps; ++step) {
+      for (int i = 0; i < size; ++i) v_H(i) = Data_t(step + my_rank * size + i);
+
+      sync.start();
+      plan.execute();
+      sync.complete();
+
+      for (int i = 0; i < size; ++i) {
+        ASSERT_EQ(v_R(my_rank * n + i), Data_t(step + left_rank * size + i));
+        ASSERT_EQ(v_R(my_rank * n + size + i),
+                  Data_t(step + right_rank * size + i));
+      }
+    }
+  }
+
+  // Global fences apply again once the NeighborSync is destroyed
+  RemoteSpace_t::fence();
+  for (int i = 0; i < size; ++i)
+    ASSERT_EQ(v_R(right_rank * n + i), Data_t(steps - 1 + my_rank * size + i));
+  RemoteSpace_t::fence();
+}
+
+TEST(TEST_CATEGORY, test_neighbor_sync) {
+  test_neighbor_sync<int>(128, 3);
+  test_neighbor_sync<double>(1000, 4);
+
+  RemoteSpace_t::fence();
+}
@@ -0,0 +1,117 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_prefetch_global(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+
+  int rows = num_ranks * size;
+  int cols = 3;
+  RemoteView_t v_R("RemoteView", rows, cols);
+
+  auto local_range = Kokkos::Experimental::get_local_range(rows);
+  Kokkos::parallel_for(
+      "Init", Kokkos::RangePolicy<>(local_range.first, local_range.second),
+      KOKKOS_LAMBDA(const int i) {
+        for (int j = 0; j < cols; ++j) v_R(i, j) = (Data_t)i * cols + j;
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  // Rows of the next rank plus the first row after them (spans two PEs)
+  int next_rank = (my_rank + 1) % num_ranks;
+  size_t first  = next_rank * size;
+  size_t last   = std::min(size_t(rows), first + size + 1);
+
+  auto handle = Kokkos::Experimental::RemoteSpaces::prefetch(
+      v_R, Kokkos::pair<size_t, size_t>(first, last));
+  handle.wait();
+
+  for (size_t i = first; i < last; ++i)
+    for (int j = 0; j < cols; ++j) {
+      ASSERT_TRUE(handle.contains(i));
+      ASSERT_EQ(handle(i, j), (Data_t)i * cols + j);
+    }
+
+  // Subviews index dim0 differently and are rejected
+  auto v_sub = Kokkos::subview(v_R, Kokkos::pair<size_t, size_t>(1, rows),
+                               Kokkos::ALL);
+  EXPECT_THROW(Kokkos::Experimental::RemoteSpaces::prefetch(
+                   v_sub, Kokkos::pair<size_t, size_t>(0, 1)),
+               std::runtime_error);
+
+  RemoteSpace_t::fence();
+}
+
+template <class Data_t>
+void test_prefetch_partitioned(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t =
+      Kokkos::View<Data_t **, Kokkos::PartitionedLayoutRight, RemoteSpace_t>;
+
+  RemoteView_t v_R("RemoteView", num_ranks, size);
+
+  Kokkos::parallel_for(
+      "Init", size, KOKKOS_LAMBDA(const int i) {
+        v_R(my_rank, i) = (Data_t)my_rank * size + i;
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  // Whole block of the next rank, fetched while this rank keeps working
+  int next_rank = (my_rank + 1) % num_ranks;
+  auto handle   = Kokkos::Experimental::RemoteSpaces::prefetch(
+      v_R, Kokkos::pair<size_t, size_t>(next_rank, next_rank + 1));
+  handle.wait();
+
+  Data_t check(0), ref(0);
+  Kokkos::parallel_reduce(
+      "Read", size,
+      KOKKOS_LAMBDA(const int i, Data_t &sum) { sum += handle(next_rank, i); },
+      check);
+  for (int i = 0; i < size; ++i) ref += (Data_t)next_rank * size + i;
+  ASSERT_EQ(check, ref);
+
+  RemoteSpace_t::fence();
+}
+
+TEST(TEST_CATEGORY, test_prefetch) {
+  test_prefetch_global<int>(1);
+  test_prefetch_global<int64_t>(1023);
+  test_prefetch_global<double>(4096);
+
+  test_prefetch_partitioned<int>(1);
+  test_prefetch_partitioned<int64_t>(1023);
+  test_prefetch_partitioned<double>(10000);
+}
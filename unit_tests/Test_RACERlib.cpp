@@ -0,0 +1,81 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+#ifdef KRS_ENABLE_RACERLIB
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_racerlib_cached_reads(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using CachedView_t =
+      Kokkos::View<const Data_t *, RemoteSpace_t,
+                   Kokkos::MemoryTraits<Kokkos::RandomAccess>>;
+  // Writable random-access views bypass RACERlib
+  using WritableView_t =
+      Kokkos::View<Data_t *, RemoteSpace_t,
+                   Kokkos::MemoryTraits<Kokkos::RandomAccess>>;
+
+  int total = num_ranks * size;
+  RemoteView_t v_R("RemoteView", total);
+  CachedView_t v_C   = v_R;
+  WritableView_t v_W = v_R;
+
+  for (int iter = 1; iter <= 2; iter++) {
+    auto local_range = Kokkos::Experimental::get_local_range(total);
+    Kokkos::parallel_for(
+        "Init", Kokkos::RangePolicy<>(local_range.first, local_range.second),
+        KOKKOS_LAMBDA(const int i) { v_W(i) = (Data_t)iter * i; });
+
+    Kokkos::fence();
+    RemoteSpace_t::fence();
+
+    // Strided reads touch all PEs, each line is read several times
+    Data_t check(0), ref(0);
+    Kokkos::parallel_reduce(
+        "CachedRead", total,
+        KOKKOS_LAMBDA(const int i, Data_t &sum) {
+          int j      = int((long(i) * 7) % total);
+          Data_t val = v_C(j);
+          sum += val;
+        },
+        check);
+    for (int i = 0; i < total; i++) ref += (Data_t)iter * i;
+
+    // Lines cached in the first iteration must not survive the fence
+    ASSERT_EQ(check, ref);
+    RemoteSpace_t::fence();
+  }
+}
+
+TEST(TEST_CATEGORY, test_racerlib_cached_reads) {
+  test_racerlib_cached_reads<int>(1);
+  test_racerlib_cached_reads<int>(1023);
+  test_racerlib_cached_reads<int64_t>(4096);
+  test_racerlib_cached_reads<double>(10000);
+}
+
+#endif  // KRS_ENABLE_RACERLIB
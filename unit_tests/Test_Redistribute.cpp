@@ -0,0 +1,116 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+// Global 2D view to global 2D view of a different layout
+template <class Data_t, class SrcLayout, class DstLayout>
+void test_redistribute_2D(int dim0, int dim1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using Src_t = Kokkos::View<Data_t **, SrcLayout, RemoteSpace_t>;
+  using Dst_t = Kokkos::View<Data_t **, DstLayout, RemoteSpace_t>;
+
+  Src_t src("SrcView", dim0, dim1);
+  Dst_t dst("DstView", dim0, dim1);
+  typename Src_t::HostMirror src_h("HostView", src.extent(0), dim1);
+  typename Dst_t::HostMirror dst_h("HostView", dst.extent(0), dim1);
+
+  size_t block = src.extent(0);
+  for (size_t i = 0; i < src_h.extent(0); ++i)
+    for (size_t j = 0; j < src_h.extent(1); ++j)
+      src_h(i, j) = Data_t((my_rank * block + i) * dim1 + j);
+
+  Kokkos::deep_copy(src, src_h);
+  RemoteSpace_t::fence();
+
+  Kokkos::Experimental::RemoteSpaces::redistribute(dst, src);
+  Kokkos::deep_copy(dst_h, dst);
+
+  block = dst.extent(0);
+  for (size_t i = 0; i < dst_h.extent(0); ++i) {
+    if (my_rank * block + i >= dim0) break;
+    for (size_t j = 0; j < dst_h.extent(1); ++j)
+      ASSERT_EQ(dst_h(i, j), Data_t((my_rank * block + i) * dim1 + j));
+  }
+}
+
+// Partitioned 2D view to global 1D view, and back to a global 2D view with
+// a different block distribution
+template <class Data_t, class Layout>
+void test_redistribute_reshape(int dim1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using Part_t = Kokkos::View<Data_t **, Layout, RemoteSpace_t>;
+  using Flat_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using Grid_t = Kokkos::View<Data_t **, Kokkos::LayoutRight, RemoteSpace_t>;
+
+  const size_t size = num_ranks * dim1;
+
+  Part_t part("PartitionedView", num_ranks, dim1);
+  Flat_t flat("FlatView", size);
+  // Shorter rows shift the block boundaries and pad the last rank
+  Grid_t grid("GridView", size / (dim1 - 1), dim1 - 1);
+
+  typename Part_t::HostMirror part_h("HostView", 1, dim1);
+  for (size_t i = 0; i < part_h.extent(1); ++i)
+    part_h(0, i) = Data_t(my_rank * dim1 + i);
+  Kokkos::deep_copy(part, part_h);
+  RemoteSpace_t::fence();
+
+  Kokkos::Experimental::RemoteSpaces::redistribute(flat, part);
+  Kokkos::Experimental::RemoteSpaces::redistribute(grid, flat);
+
+  typename Flat_t::HostMirror flat_h("HostView", flat.extent(0));
+  Kokkos::deep_copy(flat_h, flat);
+  size_t first = my_rank * flat.extent(0);
+  for (size_t i = 0; i < flat_h.extent(0) && first + i < size; ++i)
+    ASSERT_EQ(flat_h(i), Data_t(first + i));
+
+  typename Grid_t::HostMirror grid_h("HostView", grid.extent(0),
+                                     grid.extent(1));
+  Kokkos::deep_copy(grid_h, grid);
+  first = my_rank * grid.extent(0) * grid.extent(1);
+  for (size_t i = 0; i < grid_h.extent(0); ++i)
+    for (size_t j = 0; j < grid_h.extent(1); ++j) {
+      size_t g = first + i * grid.extent(1) + j;
+      if (g < size) ASSERT_EQ(grid_h(i, j), Data_t(g));
+    }
+}
+
+TEST(TEST_CATEGORY, test_redistribute) {
+  test_redistribute_2D<int, Kokkos::LayoutRight, Kokkos::LayoutLeft>(64, 7);
+  test_redistribute_2D<double, Kokkos::LayoutLeft, Kokkos::LayoutRight>(64,
+                                                                         7);
+  test_redistribute_2D<double, Kokkos::LayoutLeft, Kokkos::LayoutLeft>(33,
+                                                                       5);
+
+  test_redistribute_reshape<int, Kokkos::PartitionedLayoutRight>(12);
+  test_redistribute_reshape<double, Kokkos::PartitionedLayoutLeft>(12);
+
+  RemoteSpace_t::fence();
+}
@@ -0,0 +1,105 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t, class Layout>
+void test_root_transfers(int dim0, int dim1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_t = Kokkos::View<Data_t **, Layout, RemoteSpace_t>;
+  using ViewHost_t   = typename ViewRemote_t::HostMirror;
+  using ViewFull_t   = Kokkos::View<Data_t **, Layout, Kokkos::HostSpace>;
+  using namespace Kokkos::Experimental::RemoteSpaces;
+
+  ViewRemote_t v_R("RemoteView", dim0, dim1);
+  ViewHost_t v_H("HostView", v_R.extent(0), dim1);
+  ViewFull_t v_F("FullView", dim0, dim1);
+
+  int root       = num_ranks - 1;
+  size_t block   = v_R.extent(0);
+  size_t my_rows = my_rank * block;
+
+  for (size_t i = 0; i < block; ++i)
+    for (int j = 0; j < dim1; ++j) v_H(i, j) = Data_t((my_rows + i) * dim1 + j);
+  Kokkos::deep_copy(v_R, v_H);
+  RemoteSpace_t::fence();
+
+  gather_to(root, v_F, v_R);
+  if (my_rank == root)
+    for (int i = 0; i < dim0; ++i)
+      for (int j = 0; j < dim1; ++j) ASSERT_EQ(v_F(i, j), Data_t(i * dim1 + j));
+
+  Kokkos::deep_copy(v_F, Data_t(0));
+  allgather(v_F, v_R);
+  for (int i = 0; i < dim0; ++i)
+    for (int j = 0; j < dim1; ++j) ASSERT_EQ(v_F(i, j), Data_t(i * dim1 + j));
+
+  for (int i = 0; i < dim0; ++i)
+    for (int j = 0; j < dim1; ++j) v_F(i, j) = Data_t(2 * (i * dim1 + j));
+  scatter_from(root, v_R, v_F);
+  Kokkos::deep_copy(v_H, v_R);
+  for (size_t i = 0; i < block && my_rows + i < dim0; ++i)
+    for (int j = 0; j < dim1; ++j)
+      ASSERT_EQ(v_H(i, j), Data_t(2 * ((my_rows + i) * dim1 + j)));
+}
+
+template <class Data_t, class Layout>
+void test_root_transfers_partitioned(int dim1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_t = Kokkos::View<Data_t **, Layout, RemoteSpace_t>;
+  using ViewHost_t   = typename ViewRemote_t::HostMirror;
+  using FullLayout_t = std::conditional_t<
+      std::is_same<Layout, Kokkos::PartitionedLayoutLeft>::value,
+      Kokkos::LayoutLeft, Kokkos::LayoutRight>;
+  using ViewFull_t   = Kokkos::View<Data_t **, FullLayout_t, Kokkos::HostSpace>;
+  using namespace Kokkos::Experimental::RemoteSpaces;
+
+  ViewRemote_t v_R("RemoteView", num_ranks, dim1);
+  ViewHost_t v_H("HostView", 1, dim1);
+  ViewFull_t v_F("FullView", num_ranks, dim1);
+
+  for (int j = 0; j < dim1; ++j) v_H(0, j) = Data_t(my_rank * dim1 + j);
+  Kokkos::deep_copy(v_R, v_H);
+  RemoteSpace_t::fence();
+
+  allgather(v_F, v_R);
+  for (int i = 0; i < num_ranks; ++i)
+    for (int j = 0; j < dim1; ++j) ASSERT_EQ(v_F(i, j), Data_t(i * dim1 + j));
+}
+
+TEST(TEST_CATEGORY, test_root_transfers) {
+  test_root_transfers<int, Kokkos::LayoutRight>(35, 17);
+  test_root_transfers<double, Kokkos::LayoutLeft>(35, 17);
+  test_root_transfers<double, Kokkos::LayoutRight>(1000, 333);
+
+  test_root_transfers_partitioned<int, Kokkos::PartitionedLayoutRight>(123);
+  test_root_transfers_partitioned<double, Kokkos::PartitionedLayoutLeft>(123);
+
+  RemoteSpace_t::fence();
+}
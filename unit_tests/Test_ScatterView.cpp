@@ -0,0 +1,130 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_remote_scatter_view_dense(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using ScatterView_t =
+      Kokkos::Experimental::RemoteSpaces::RemoteScatterView<RemoteView_t>;
+
+  int total = num_ranks * size;
+  RemoteView_t v_R("RemoteView", total);
+  auto local_range = Kokkos::Experimental::get_local_range(total);
+
+  Kokkos::parallel_for(
+      "Init", Kokkos::RangePolicy<>(local_range.first, local_range.second),
+      KOKKOS_LAMBDA(const int i) { v_R(i) = (Data_t)i; });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  ScatterView_t scatter(v_R);
+  auto scatter_view = scatter.scatter_view();
+
+  auto sub = Kokkos::subview(v_R, Kokkos::make_pair(1, total));
+  using SubScatterView_t =
+      Kokkos::Experimental::RemoteSpaces::RemoteScatterView<decltype(sub)>;
+  EXPECT_THROW((SubScatterView_t(sub)), std::runtime_error);
+
+  // Histogram: every PE contributes twice to every global index
+  for (int iter = 1; iter <= 2; iter++) {
+    Kokkos::parallel_for(
+        "Contribute", 2 * total, KOKKOS_LAMBDA(const int i) {
+          auto access = scatter_view.access();
+          access(i % total) += (Data_t)1;
+        });
+    Kokkos::fence();
+    scatter.contribute();
+    RemoteSpace_t::fence();
+
+    Kokkos::parallel_for(
+        "Check", Kokkos::RangePolicy<>(local_range.first, local_range.second),
+        KOKKOS_LAMBDA(const int i) {
+          if (v_R(i) != (Data_t)(i + 2 * iter * num_ranks))
+            Kokkos::abort("Unexpected value after contribute");
+        });
+    Kokkos::fence();
+    RemoteSpace_t::fence();
+  }
+}
+
+template <class Data_t>
+void test_remote_scatter_view_sparse(int size, int num_indices) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using IndexView_t  = Kokkos::View<int64_t *, Kokkos::HostSpace>;
+  using ScatterView_t =
+      Kokkos::Experimental::RemoteSpaces::RemoteScatterView<RemoteView_t>;
+
+  int total = num_ranks * size;
+  RemoteView_t v_R("RemoteView", total);
+
+  // Every PE contributes to a few elements of every PE, with repeats
+  IndexView_t indices("Indices", num_indices);
+  for (int k = 0; k < num_indices; ++k)
+    indices(k) = (k % num_ranks) * int64_t(size) + (k / num_ranks) % 3;
+
+  ScatterView_t scatter(v_R, indices);
+  auto scatter_view = scatter.scatter_view();
+  ASSERT_LE(scatter.buffer_size(), size_t(3 * num_ranks));
+
+  auto remap = Kokkos::create_mirror_view_and_copy(
+      Kokkos::DefaultExecutionSpace(), scatter.remapped_indices());
+  Kokkos::parallel_for(
+      "Contribute", num_indices, KOKKOS_LAMBDA(const int k) {
+        auto access = scatter_view.access();
+        access(remap(k)) += (Data_t)1;
+      });
+  Kokkos::fence();
+  scatter.contribute();
+  RemoteSpace_t::fence();
+
+  // Expected count of index j of every block, from all PEs
+  std::vector<Data_t> expected(3, 0);
+  for (int k = 0; k < num_indices; ++k)
+    if (k % num_ranks == my_rank) expected[(k / num_ranks) % 3] += 1;
+
+  Data_t *local = v_R.data();
+  for (int j = 0; j < 3 && j < size; ++j)
+    ASSERT_EQ(local[j], expected[j] * num_ranks);
+
+  RemoteSpace_t::fence();
+}
+
+TEST(TEST_CATEGORY, test_remote_scatter_view) {
+  test_remote_scatter_view_dense<int>(1);
+  test_remote_scatter_view_dense<int64_t>(1023);
+  test_remote_scatter_view_dense<double>(10000);
+  test_remote_scatter_view_sparse<int>(3, 1);
+  test_remote_scatter_view_sparse<int64_t>(1023, 4096);
+  test_remote_scatter_view_sparse<double>(10000, 50000);
+}
@@ -0,0 +1,94 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t, class SrcLayout, class DstLayout>
+void test_transpose_2D(int dim0, int dim1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using Src_t = Kokkos::View<Data_t **, SrcLayout, RemoteSpace_t>;
+  using Dst_t = Kokkos::View<Data_t **, DstLayout, RemoteSpace_t>;
+
+  Src_t src("SrcView", dim0, dim1);
+  Dst_t dst("DstView", dim1, dim0);
+  typename Src_t::HostMirror src_h("HostView", src.extent(0), dim1);
+  typename Dst_t::HostMirror dst_h("HostView", dst.extent(0), dim0);
+
+  size_t first = my_rank * src.extent(0);
+  for (size_t i = 0; i < src_h.extent(0); ++i)
+    for (int j = 0; j < dim1; ++j)
+      src_h(i, j) = Data_t((first + i) * dim1 + j);
+  Kokkos::deep_copy(src, src_h);
+  RemoteSpace_t::fence();
+
+  Kokkos::Experimental::RemoteSpaces::transpose(dst, src);
+  Kokkos::deep_copy(dst_h, dst);
+
+  first = my_rank * dst.extent(0);
+  for (size_t j = 0; j < dst_h.extent(0) && first + j < dim1; ++j)
+    for (int i = 0; i < dim0; ++i)
+      ASSERT_EQ(dst_h(j, i), Data_t(i * dim1 + first + j));
+}
+
+// (P, m, n) blocks of rows to (P, n / P, P * m)
+template <class Data_t, class Layout>
+void test_transpose_partitioned(int m, int k) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using View_t = Kokkos::View<Data_t ***, Layout, RemoteSpace_t>;
+
+  const int n = num_ranks * k;
+  View_t src("SrcView", num_ranks, m, n);
+  View_t dst("DstView", num_ranks, k, num_ranks * m);
+  typename View_t::HostMirror src_h("HostView", 1, m, n);
+  typename View_t::HostMirror dst_h("HostView", 1, k, num_ranks * m);
+
+  for (int i = 0; i < m; ++i)
+    for (int j = 0; j < n; ++j)
+      src_h(0, i, j) = Data_t((my_rank * m + i) * n + j);
+  Kokkos::deep_copy(src, src_h);
+  RemoteSpace_t::fence();
+
+  Kokkos::Experimental::RemoteSpaces::transpose(dst, src);
+  Kokkos::deep_copy(dst_h, dst);
+
+  for (int j = 0; j < k; ++j)
+    for (int i = 0; i < num_ranks * m; ++i)
+      ASSERT_EQ(dst_h(0, j, i), Data_t(i * n + my_rank * k + j));
+}
+
+TEST(TEST_CATEGORY, test_transpose) {
+  test_transpose_2D<int, Kokkos::LayoutRight, Kokkos::LayoutRight>(64, 48);
+  test_transpose_2D<double, Kokkos::LayoutRight, Kokkos::LayoutLeft>(37, 70);
+  test_transpose_2D<double, Kokkos::LayoutLeft, Kokkos::LayoutRight>(101, 9);
+
+  test_transpose_partitioned<int, Kokkos::PartitionedLayoutRight>(40, 33);
+  test_transpose_partitioned<double, Kokkos::PartitionedLayoutLeft>(7, 5);
+
+  RemoteSpace_t::fence();
+}
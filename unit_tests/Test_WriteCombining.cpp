@@ -0,0 +1,148 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// Contact: Jan Ciesko (jciesko@sandia.gov)
+//
+//@HEADER
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+/* Scatter: consecutive iterations store to different PEs and with a
+ * stride, so runs of contiguous stores break and restart */
+template <class Data_t>
+void test_scatter_stores(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using HostSpace_t  = typename RemoteView_t::HostMirror;
+
+  RemoteView_t v_R("RemoteView", num_ranks, size);
+  HostSpace_t v_H("HostView", v_R.extent(0), size);
+
+  Kokkos::parallel_for(
+      "Scatter", size * num_ranks, KOKKOS_LAMBDA(const int j) {
+        int pe    = j % num_ranks;
+        int index = j / num_ranks;
+        if (index % num_ranks == my_rank)
+          v_R(pe, index) = (Data_t)my_rank * size + index;
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  Kokkos::deep_copy(v_H, v_R);
+
+  for (int i = 0; i < size; ++i)
+    ASSERT_EQ(v_H(0, i), (Data_t)(i % num_ranks) * size + i);
+}
+
+/* Contiguous stores of a block to the next PE */
+template <class Data_t>
+void test_shift_stores(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using HostSpace_t  = typename RemoteView_t::HostMirror;
+
+  RemoteView_t v_R("RemoteView", num_ranks, size);
+  HostSpace_t v_H("HostView", v_R.extent(0), size);
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  int prev_rank = (my_rank + num_ranks - 1) % num_ranks;
+
+  Kokkos::parallel_for(
+      "Shift", size, KOKKOS_LAMBDA(const int i) {
+        v_R(next_rank, i) = (Data_t)my_rank * size + i;
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  Kokkos::deep_copy(v_H, v_R);
+
+  for (int i = 0; i < size; ++i)
+    ASSERT_EQ(v_H(0, i), (Data_t)prev_rank * size + i);
+}
+
+/* Read-modify-writes and reads of an element observe an earlier store of
+ * the same thread that is still buffered */
+template <class Data_t>
+void test_store_then_access(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using HostSpace_t  = typename RemoteView_t::HostMirror;
+  using LocalView_t  = Kokkos::View<Data_t *>;
+
+  RemoteView_t v_R("RemoteView", num_ranks, size);
+  HostSpace_t v_H("HostView", v_R.extent(0), size);
+  LocalView_t v_L("LocalView", size);
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  int prev_rank = (my_rank + num_ranks - 1) % num_ranks;
+
+  Kokkos::parallel_for(
+      "StoreThenRead", size, KOKKOS_LAMBDA(const int i) {
+        v_R(next_rank, i) = (Data_t)my_rank * size + i;
+        v_L(i)            = v_R(next_rank, i);
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  auto v_L_H = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v_L);
+  for (int i = 0; i < size; ++i)
+    ASSERT_EQ(v_L_H(i), (Data_t)my_rank * size + i);
+
+  Kokkos::parallel_for(
+      "StoreThenAdd", size, KOKKOS_LAMBDA(const int i) {
+        v_R(next_rank, i) = (Data_t)i;
+        v_R(next_rank, i) += (Data_t)my_rank;
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t::fence();
+
+  Kokkos::deep_copy(v_H, v_R);
+
+  for (int i = 0; i < size; ++i)
+    ASSERT_EQ(v_H(0, i), (Data_t)i + prev_rank);
+}
+
+TEST(TEST_CATEGORY, test_write_combining) {
+  test_shift_stores<int>(1);
+  test_shift_stores<int>(4097);
+  test_shift_stores<int64_t>(10000);
+  test_shift_stores<double>(12345);
+
+  test_scatter_stores<int>(1);
+  test_scatter_stores<int64_t>(4097);
+  test_scatter_stores<double>(10000);
+
+  test_store_then_access<int>(1);
+  test_store_then_access<int64_t>(4097);
+  test_store_then_access<double>(10000);
+}